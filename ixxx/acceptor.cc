@@ -0,0 +1,84 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "acceptor.hh"
+
+#if defined(__linux__)
+
+#include "posix.hh"
+#include "linux.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        acceptor::acceptor(int listen_fd, int flags)
+            : fd_(listen_fd), flags_(flags)
+        {
+            int fl = posix::fcntl(fd_, F_GETFL, 0);
+            if (!(fl & O_NONBLOCK))
+                posix::fcntl(fd_, F_SETFL, fl | O_NONBLOCK);
+        }
+
+        int acceptor::fd() const
+        {
+            return fd_;
+        }
+
+        void acceptor::attach(int epfd, uint64_t data)
+        {
+            struct epoll_event ev;
+            ev.events   = EPOLLIN | EPOLLEXCLUSIVE;
+            ev.data.u64 = data;
+            linux::epoll_ctl(epfd, EPOLL_CTL_ADD, fd_, &ev);
+        }
+        void acceptor::detach(int epfd)
+        {
+            linux::epoll_ctl(epfd, EPOLL_CTL_DEL, fd_, nullptr);
+        }
+
+        int acceptor::accept_one(struct sockaddr_storage &addr, socklen_t &len)
+        {
+            for (;;) {
+                len = sizeof addr;
+                int r = ::accept4(fd_, reinterpret_cast<struct sockaddr*>(&addr),
+                        &len, flags_);
+                if (r != -1)
+                    return r;
+                switch (errno) {
+                    case EAGAIN:
+#if EAGAIN != EWOULDBLOCK
+                    case EWOULDBLOCK:
+#endif
+                        return -1;
+                    // cf. accept(2): pending network errors of the new
+                    // connection are reported by accept() and should be
+                    // treated like EAGAIN by retrying
+                    case EINTR:
+                    case ECONNABORTED:
+                    case EPROTO:
+                    case ENETDOWN:
+                    case EHOSTDOWN:
+                    case ENONET:
+                    case EHOSTUNREACH:
+                    case ENETUNREACH:
+                        continue;
+                    // e.g. EOPNOTSUPP for a socket that isn't SOCK_STREAM,
+                    // i.e. retrying would spin forever
+                    default:
+                        throw accept4_error(errno);
+                }
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
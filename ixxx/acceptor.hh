@@ -0,0 +1,81 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_ACCEPTOR_HH
+#define IXXX_ACCEPTOR_HH
+
+#include <ixxx/fd.hh>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Accepts connections in batches with accept4(), i.e. accepted
+        // sockets are created with SOCK_NONBLOCK | SOCK_CLOEXEC and don't
+        // need extra fcntl() calls.
+        //
+        // An empty backlog (EAGAIN) is the regular end of a batch and
+        // thus isn't reported as exception. Likewise, errors that are
+        // specific to a single pending connection (e.g. ECONNABORTED)
+        // are skipped. Other errors (e.g. EOPNOTSUPP for a socket that
+        // isn't SOCK_STREAM) are thrown as accept4_error.
+        //
+        // The listening socket is switched to non-blocking mode.
+        class acceptor {
+            public:
+                explicit acceptor(int listen_fd,
+                        int flags = SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+                int fd() const;
+
+                // Registers the listening socket with EPOLLIN | EPOLLEXCLUSIVE,
+                // i.e. when several worker threads wait on the same listener
+                // in their own epoll instances, only one of them is woken up
+                // per new connection.
+                void attach(int epfd, uint64_t data);
+                void detach(int epfd);
+
+                // Accepts until the backlog is drained (or max connections
+                // are accepted) and calls
+                // f(unique_fd fd, const struct sockaddr_storage &addr,
+                //   socklen_t len)
+                // for each of them, i.e. a connection is closed unless f
+                // takes it over. Returns the number of accepted connections.
+                template <typename F> size_t drain(F f, size_t max = SIZE_MAX)
+                {
+                    size_t n = 0;
+                    struct sockaddr_storage addr;
+                    socklen_t len;
+                    for (; n < max; ++n) {
+                        int fd = accept_one(addr, len);
+                        if (fd == -1)
+                            break;
+                        f(unique_fd(fd), addr, len);
+                    }
+                    return n;
+                }
+            private:
+                // returns -1 if the backlog is empty
+                int accept_one(struct sockaddr_storage &addr, socklen_t &len);
+
+                int fd_;
+                int flags_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_ACCEPTOR_HH
@@ -0,0 +1,444 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_CORO_HH
+#define IXXX_CORO_HH
+
+// Optional C++20 coroutine support on top of util::reactor and
+// util::timer_wheel. Header-only, i.e. the library itself is still
+// built as C++11 - the content of this header is only available when the
+// including translation unit is compiled with coroutine support.
+
+#if defined(__linux__) && defined(__cpp_impl_coroutine)
+
+#include <ixxx/reactor.hh>
+#include <ixxx/timer_wheel.hh>
+#include <ixxx/sys_error.hh>
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <new>
+#include <optional>
+#include <utility>
+#include <stddef.h>
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        namespace coro {
+
+            // Per-thread cache of coroutine frames, binned into size
+            // classes of 64 bytes (up to 1 KiB, larger frames aren't
+            // cached). After warm-up, starting a task doesn't allocate.
+            //
+            // A frame may be freed by another thread than the one that
+            // allocated it, it then just ends up in that thread's cache.
+            class frame_pool {
+                public:
+                    enum { granularity = 64, classes = 16, max_cached = 256 };
+
+                    static frame_pool &local()
+                    {
+                        static thread_local frame_pool p;
+                        return p;
+                    }
+
+                    frame_pool() = default;
+                    frame_pool(const frame_pool &) = delete;
+                    frame_pool &operator=(const frame_pool &) = delete;
+                    ~frame_pool()
+                    {
+                        for (unsigned i = 0; i < classes; ++i) {
+                            while (free_[i]) {
+                                block *b = free_[i];
+                                free_[i] = b->next;
+                                ::operator delete(b);
+                            }
+                        }
+                    }
+
+                    void *allocate(size_t n)
+                    {
+                        size_t c = size_class(n);
+                        if (c >= classes)
+                            return ::operator new(n);
+                        if (block *b = free_[c]) {
+                            free_[c] = b->next;
+                            --count_[c];
+                            return b;
+                        }
+                        return ::operator new((c + 1) * granularity);
+                    }
+                    void deallocate(void *p, size_t n) noexcept
+                    {
+                        size_t c = size_class(n);
+                        if (c >= classes || count_[c] >= max_cached) {
+                            ::operator delete(p);
+                            return;
+                        }
+                        block *b = static_cast<block*>(p);
+                        b->next = free_[c];
+                        free_[c] = b;
+                        ++count_[c];
+                    }
+
+                    // number of cached frames
+                    size_t cached() const
+                    {
+                        size_t n = 0;
+                        for (unsigned i = 0; i < classes; ++i)
+                            n += count_[i];
+                        return n;
+                    }
+                private:
+                    struct block { block *next; };
+                    static size_t size_class(size_t n)
+                    {
+                        return n ? (n - 1) / granularity : 0;
+                    }
+
+                    block *free_[classes] = { nullptr };
+                    size_t count_[classes] = { 0 };
+            };
+
+            template <typename T = void> class task;
+
+            namespace detail {
+
+                struct promise_base {
+                    struct final_awaiter {
+                        bool await_ready() noexcept { return false; }
+                        template <typename P>
+                        std::coroutine_handle<> await_suspend(
+                                std::coroutine_handle<P> h) noexcept
+                        {
+                            std::coroutine_handle<> c = h.promise().continuation;
+                            return c ? c : std::noop_coroutine();
+                        }
+                        void await_resume() noexcept {}
+                    };
+
+                    static void *operator new(size_t n)
+                    {
+                        return frame_pool::local().allocate(n);
+                    }
+                    static void operator delete(void *p, size_t n) noexcept
+                    {
+                        frame_pool::local().deallocate(p, n);
+                    }
+
+                    std::suspend_always initial_suspend() noexcept { return {}; }
+                    final_awaiter final_suspend() noexcept { return {}; }
+                    void unhandled_exception()
+                    {
+                        error = std::current_exception();
+                    }
+
+                    std::coroutine_handle<> continuation;
+                    std::exception_ptr error;
+                };
+
+                template <typename T>
+                struct promise : promise_base {
+                    task<T> get_return_object();
+                    void return_value(T v) { value.emplace(std::move(v)); }
+                    T result()
+                    {
+                        if (error)
+                            std::rethrow_exception(error);
+                        return std::move(*value);
+                    }
+
+                    std::optional<T> value;
+                };
+
+                template <>
+                struct promise<void> : promise_base {
+                    task<void> get_return_object();
+                    void return_void() {}
+                    void result()
+                    {
+                        if (error)
+                            std::rethrow_exception(error);
+                    }
+                };
+
+            }
+
+            // Lazily started coroutine, i.e. it runs when it's awaited
+            // or - for a top-level task - when start() is called.
+            // Exceptions are rethrown to the awaiter or by get().
+            template <typename T>
+            class task {
+                public:
+                    typedef detail::promise<T> promise_type;
+                    typedef std::coroutine_handle<promise_type> handle;
+
+                    task() = default;
+                    explicit task(handle h) : h_(h) {}
+                    task(task &&o) noexcept : h_(std::exchange(o.h_, {})) {}
+                    task &operator=(task &&o) noexcept
+                    {
+                        if (this != &o) {
+                            if (h_)
+                                h_.destroy();
+                            h_ = std::exchange(o.h_, {});
+                        }
+                        return *this;
+                    }
+                    task(const task &) = delete;
+                    task &operator=(const task &) = delete;
+                    // destroys a still suspended coroutine, too
+                    ~task()
+                    {
+                        if (h_)
+                            h_.destroy();
+                    }
+
+                    // runs a top-level task until its first suspension
+                    void start() { h_.resume(); }
+                    bool done() const { return !h_ || h_.done(); }
+                    // the result of a finished task, rethrows its exception
+                    T get() { return h_.promise().result(); }
+
+                    auto operator co_await() && noexcept
+                    {
+                        struct awaiter {
+                            bool await_ready() noexcept { return false; }
+                            std::coroutine_handle<> await_suspend(
+                                    std::coroutine_handle<> c) noexcept
+                            {
+                                h.promise().continuation = c;
+                                return h;
+                            }
+                            T await_resume() { return h.promise().result(); }
+
+                            handle h;
+                        };
+                        return awaiter{h_};
+                    }
+                private:
+                    handle h_;
+            };
+
+            namespace detail {
+
+                template <typename T>
+                inline task<T> promise<T>::get_return_object()
+                {
+                    return task<T>(task<T>::handle::from_promise(*this));
+                }
+                inline task<void> promise<void>::get_return_object()
+                {
+                    return task<void>(task<void>::handle::from_promise(*this));
+                }
+
+            }
+
+            // Registers a nonblocking descriptor edge-triggered for reading
+            // and writing in a reactor, i.e. exactly once and not per
+            // operation. At most one coroutine may wait for each direction.
+            class async_fd {
+                public:
+                    async_fd(reactor &r, int fd)
+                        : r_(r), fd_(fd)
+                    {
+                        r_.add(fd_, EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET,
+                                [this](int, uint32_t events) {
+                                    dispatch(events);
+                                });
+                    }
+                    // doesn't close the descriptor
+                    ~async_fd() { r_.remove(fd_); }
+                    async_fd(const async_fd &) = delete;
+                    async_fd &operator=(const async_fd &) = delete;
+
+                    int fd() const { return fd_; }
+
+                    // suspends until the descriptor becomes readable
+                    // (or hung up, or failed)
+                    auto readable() noexcept { return waiter{reader_, {}}; }
+                    // suspends until the descriptor becomes writable
+                    auto writable() noexcept { return waiter{writer_, {}}; }
+                private:
+                    struct waiter {
+                        // i.e. when the suspended coroutine is destroyed
+                        ~waiter()
+                        {
+                            if (h && slot == h)
+                                slot = {};
+                        }
+                        bool await_ready() noexcept { return false; }
+                        void await_suspend(std::coroutine_handle<> c) noexcept
+                        {
+                            slot = h = c;
+                        }
+                        void await_resume() noexcept {}
+
+                        std::coroutine_handle<> &slot;
+                        std::coroutine_handle<> h {};
+                    };
+
+                    void dispatch(uint32_t events)
+                    {
+                        std::coroutine_handle<> rd, wr;
+                        if (events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+                            rd = std::exchange(reader_, {});
+                        if (events & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+                            wr = std::exchange(writer_, {});
+                        // this object might be gone after the first resume
+                        if (rd)
+                            rd.resume();
+                        if (wr)
+                            wr.resume();
+                    }
+
+                    reactor &r_;
+                    int fd_;
+                    std::coroutine_handle<> reader_;
+                    std::coroutine_handle<> writer_;
+            };
+
+            // Reads up to n bytes, returns 0 at EOF.
+            inline task<size_t> async_read(async_fd &f, void *buf, size_t n)
+            {
+                for (;;) {
+                    ssize_t r = ::read(f.fd(), buf, n);
+                    if (r != -1)
+                        co_return size_t(r);
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        co_await f.readable();
+                    else if (errno != EINTR)
+                        throw read_error(errno);
+                }
+            }
+
+            // Writes all n bytes.
+            inline task<size_t> async_write(async_fd &f, const void *buf,
+                    size_t n)
+            {
+                const char *p = static_cast<const char*>(buf);
+                size_t k = 0;
+                while (k < n) {
+                    ssize_t r = ::write(f.fd(), p + k, n - k);
+                    if (r != -1)
+                        k += size_t(r);
+                    else if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        co_await f.writable();
+                    else if (errno != EINTR)
+                        throw write_error(errno);
+                }
+                co_return k;
+            }
+
+            // Returns a nonblocking close-on-exec connection descriptor.
+            inline task<int> async_accept(async_fd &f,
+                    struct sockaddr *addr = nullptr,
+                    socklen_t *addrlen = nullptr)
+            {
+                for (;;) {
+                    int r = ::accept4(f.fd(), addr, addrlen,
+                            SOCK_NONBLOCK | SOCK_CLOEXEC);
+                    if (r != -1)
+                        co_return r;
+                    switch (errno) {
+                        case EAGAIN:
+#if EAGAIN != EWOULDBLOCK
+                        case EWOULDBLOCK:
+#endif
+                            co_await f.readable();
+                            break;
+                        // cf. accept(2), errors of the new connection
+                        case EINTR:
+                        case ECONNABORTED:
+                        case EPROTO:
+                            break;
+                        default:
+                            throw accept4_error(errno);
+                    }
+                }
+            }
+
+            inline task<void> async_connect(async_fd &f,
+                    const struct sockaddr *addr, socklen_t addrlen)
+            {
+                if (::connect(f.fd(), addr, addrlen) == 0)
+                    co_return;
+                if (errno != EINPROGRESS && errno != EINTR)
+                    throw connect_error(errno);
+                for (;;) {
+                    co_await f.writable();
+                    int e = 0;
+                    socklen_t n = sizeof e;
+                    if (::getsockopt(f.fd(), SOL_SOCKET, SO_ERROR, &e, &n) == -1)
+                        throw getsockopt_error(errno);
+                    if (e)
+                        throw connect_error(e);
+                    // the registration might report the writability of
+                    // the not yet connected socket, i.e. before connect()
+                    struct sockaddr_storage a;
+                    n = sizeof a;
+                    if (::getpeername(f.fd(),
+                                reinterpret_cast<struct sockaddr*>(&a), &n) == 0)
+                        co_return;
+                    if (errno != ENOTCONN)
+                        throw connect_error(errno);
+                }
+            }
+
+            // Suspends for at least delay, the timer is cancelled when
+            // the suspended coroutine is destroyed.
+            class sleep_for {
+                public:
+                    sleep_for(timer_wheel &w, std::chrono::nanoseconds delay)
+                        : w_(w), delay_(delay)
+                    {
+                    }
+                    sleep_for(const sleep_for &) = delete;
+                    sleep_for &operator=(const sleep_for &) = delete;
+                    ~sleep_for()
+                    {
+                        if (pending_)
+                            w_.cancel(id_);
+                    }
+
+                    bool await_ready() const noexcept
+                    {
+                        return delay_.count() <= 0;
+                    }
+                    void await_suspend(std::coroutine_handle<> h)
+                    {
+                        h_ = h;
+                        // small enough for std::function's small buffer
+                        id_ = w_.schedule(delay_, [this] {
+                                pending_ = false;
+                                h_.resume();
+                            });
+                        pending_ = true;
+                    }
+                    void await_resume() noexcept {}
+                private:
+                    timer_wheel &w_;
+                    std::chrono::nanoseconds delay_;
+                    std::coroutine_handle<> h_;
+                    timer_wheel::timer_id id_ {0};
+                    bool pending_ {false};
+            };
+
+        }
+
+    }
+
+}
+
+#endif // __linux__ && __cpp_impl_coroutine
+
+#endif // IXXX_CORO_HH
@@ -0,0 +1,106 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "deadline.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "posix.hh"
+#include "sys_error.hh"
+
+#include <atomic>
+
+#include <errno.h>
+#include <limits.h>
+#include <sys/epoll.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        int64_t deadline::now_ns()
+        {
+            struct timespec ts;
+            posix::clock_gettime(CLOCK_MONOTONIC, &ts);
+            return int64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+        }
+
+        deadline::deadline(std::chrono::nanoseconds delay)
+            : at_(now_ns() + delay.count())
+        {
+        }
+
+        deadline deadline::at(int64_t monotonic_ns)
+        {
+            deadline d;
+            d.at_ = monotonic_ns;
+            return d;
+        }
+
+        std::chrono::nanoseconds deadline::remaining() const
+        {
+            int64_t d = at_ - now_ns();
+            return std::chrono::nanoseconds(d > 0 ? d : 0);
+        }
+
+        struct timespec deadline::remaining_timespec() const
+        {
+            int64_t d = remaining().count();
+            struct timespec ts;
+            ts.tv_sec  = d / 1000000000;
+            ts.tv_nsec = d % 1000000000;
+            return ts;
+        }
+
+        int wait_until(const deadline &d, struct pollfd *fds, nfds_t nfds,
+                const sigset_t *sigmask)
+        {
+            struct timespec ts = d.remaining_timespec();
+            try {
+                return linux::ppoll(fds, nfds, &ts, sigmask);
+            } catch (const ppoll_error &e) {
+                if (e.code() == EINTR)
+                    return -1;
+                throw;
+            }
+        }
+
+        static std::atomic<bool> have_epoll_pwait2 {true};
+
+        int wait_until(const deadline &d, int epfd, struct epoll_event *events,
+                int maxevents, const sigset_t *sigmask)
+        {
+            struct timespec ts = d.remaining_timespec();
+            if (have_epoll_pwait2.load(std::memory_order_relaxed)) {
+                try {
+                    return linux::epoll_pwait2(epfd, events, maxevents, &ts,
+                            sigmask);
+                } catch (const epoll_pwait2_error &e) {
+                    if (e.code() == EINTR)
+                        return -1;
+                    if (e.code() != ENOSYS)
+                        throw;
+                    have_epoll_pwait2.store(false, std::memory_order_relaxed);
+                }
+            }
+            int64_t ns = d.remaining().count();
+            int64_t ms = (ns + 999999) / 1000000;
+            if (ms > INT_MAX)
+                ms = INT_MAX;
+            try {
+                return linux::epoll_pwait(epfd, events, maxevents, int(ms),
+                        sigmask);
+            } catch (const epoll_pwait_error &e) {
+                if (e.code() == EINTR)
+                    return -1;
+                throw;
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,70 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_DEADLINE_HH
+#define IXXX_DEADLINE_HH
+
+#include <chrono>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#endif
+
+struct epoll_event;
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Absolute point in time on CLOCK_MONOTONIC.
+        //
+        // In contrast to relative millisecond timeouts, waiting for a
+        // deadline neither oversleeps by up to a millisecond nor
+        // accumulates drift when a wait is interrupted or repeated.
+        class deadline {
+            public:
+                // now + delay
+                explicit deadline(std::chrono::nanoseconds delay);
+                // monotonic_ns as returned by now_ns()
+                static deadline at(int64_t monotonic_ns);
+                static int64_t now_ns();
+
+                // moves the deadline by d, e.g. to the next period of a
+                // pacing loop
+                void advance(std::chrono::nanoseconds d) { at_ += d.count(); }
+                int64_t ns() const { return at_; }
+
+                // zero if expired
+                std::chrono::nanoseconds remaining() const;
+                bool expired() const { return !remaining().count(); }
+                struct timespec remaining_timespec() const;
+            private:
+                deadline() = default;
+                int64_t at_ {0};
+        };
+
+        // Waits with ppoll() until an event or the deadline (nfds may be
+        // 0, for just sleeping). Returns the number of ready descriptors,
+        // 0 on timeout and -1 when interrupted by a signal (e.g. one
+        // that is unblocked by sigmask).
+        int wait_until(const deadline &d, struct pollfd *fds, nfds_t nfds,
+                const sigset_t *sigmask = nullptr);
+        // Waits with epoll_pwait2(), on kernels before 5.11 it falls back
+        // to epoll_pwait() with the remaining time rounded up to
+        // milliseconds. Same return values as above.
+        int wait_until(const deadline &d, int epfd, struct epoll_event *events,
+                int maxevents, const sigset_t *sigmask = nullptr);
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_DEADLINE_HH
@@ -0,0 +1,226 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "dir_handle.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "posix.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdint.h>
+
+#if defined(__has_include)
+#if __has_include(<linux/openat2.h>)
+#include <linux/openat2.h>
+#define IXXX_HAVE_OPENAT2_H
+#endif
+#endif
+
+// kernel headers < 5.6, the syscall might still be available at runtime
+#if !defined(IXXX_HAVE_OPENAT2_H)
+struct open_how {
+    uint64_t flags;
+    uint64_t mode;
+    uint64_t resolve;
+};
+#define RESOLVE_NO_SYMLINKS 0x04
+#define RESOLVE_BENEATH     0x08
+#endif
+// kernel headers < 5.12
+#if !defined(RESOLVE_CACHED)
+#define RESOLVE_CACHED      0x20
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+        dir_handle::dir_handle(const char *root, size_t max_cached)
+            : root_(posix::open(root, O_PATH | O_DIRECTORY | O_CLOEXEC)),
+              max_(max_cached ? max_cached : 1)
+        {
+        }
+        dir_handle::dir_handle(const std::string &root, size_t max_cached)
+            : dir_handle(root.c_str(), max_cached)
+        {
+        }
+
+        int dir_handle::fd() const
+        {
+            return root_.get();
+        }
+        size_t dir_handle::cached() const
+        {
+            return lru_.size();
+        }
+        void dir_handle::invalidate(const std::string &dir)
+        {
+            auto i = index_.find(dir);
+            if (i == index_.end())
+                return;
+            lru_.erase(i->second);
+            index_.erase(i);
+        }
+        void dir_handle::clear()
+        {
+            index_.clear();
+            lru_.clear();
+        }
+
+        unique_fd dir_handle::open(const std::string &path, int flags, mode_t mode)
+        {
+            return open(path.c_str(), flags, mode);
+        }
+
+        unique_fd dir_handle::open(const char *path, int flags, mode_t mode)
+        {
+            const char *slash = strrchr(path, '/');
+            int r = -1;
+            if (*path == '/') {
+                // as RESOLVE_BENEATH does, cf. walk()
+                errno = EXDEV;
+            } else if (!slash) {
+                r = resolve(root_.get(), path, flags, mode);
+            } else {
+                std::string dir(path, slash - path);
+                const char *name = slash + 1;
+                bool hit = false;
+                int dfd = lookup(dir, hit);
+                r = resolve(dfd, name, flags, mode);
+                if (r == -1 && errno == ENOENT && hit) {
+                    // directory might have been renamed or replaced
+                    invalidate(dir);
+                    dfd = lookup(dir, hit);
+                    r = resolve(dfd, name, flags, mode);
+                }
+            }
+            if (r == -1) {
+                if (have_openat2_)
+                    throw openat2_error(errno);
+                else
+                    throw openat_error(errno);
+            }
+            return unique_fd(r);
+        }
+
+        int dir_handle::lookup(const std::string &dir, bool &hit)
+        {
+            auto i = index_.find(dir);
+            if (i != index_.end()) {
+                hit = true;
+                lru_.splice(lru_.begin(), lru_, i->second);
+                return i->second->fd.get();
+            }
+            hit = false;
+            int fd = open_dir(dir);
+            lru_.push_front(entry{dir, unique_fd(fd)});
+            index_[dir] = lru_.begin();
+            if (lru_.size() > max_) {
+                index_.erase(lru_.back().dir);
+                lru_.pop_back();
+            }
+            return fd;
+        }
+
+        int dir_handle::open_dir(const std::string &dir)
+        {
+            int r = resolve(root_.get(), dir.c_str(),
+                    O_PATH | O_DIRECTORY | O_CLOEXEC, 0);
+            if (r == -1) {
+                if (have_openat2_)
+                    throw openat2_error(errno);
+                else
+                    throw openat_error(errno);
+            }
+            return r;
+        }
+
+        // returns -1 and sets errno on error
+        int dir_handle::resolve(int dirfd, const char *path, int flags, mode_t mode)
+        {
+            if (have_openat2_) {
+                struct open_how how = open_how();
+                how.flags   = flags;
+                if (flags & (O_CREAT | O_TMPFILE))
+                    how.mode = mode;
+                how.resolve = RESOLVE_BENEATH | RESOLVE_NO_SYMLINKS;
+                // RESOLVE_CACHED fails with EAGAIN for those
+                if (have_cached_ && !(flags & (O_CREAT | O_TRUNC | O_TMPFILE)))
+                    how.resolve |= RESOLVE_CACHED;
+                for (;;) {
+                    try {
+                        return linux::openat2(dirfd, path, &how, sizeof how);
+                    } catch (const openat2_error &e) {
+                        errno = e.code();
+                    }
+                    if (how.resolve & RESOLVE_CACHED) {
+                        // EAGAIN: not everything is in the dentry cache,
+                        // EINVAL: kernel < 5.12 doesn't know RESOLVE_CACHED
+                        if (errno == EINVAL)
+                            have_cached_ = false;
+                        if (errno == EAGAIN || errno == EINVAL) {
+                            how.resolve &= ~RESOLVE_CACHED;
+                            continue;
+                        }
+                    }
+                    // also without SYS_openat2 at build time
+                    if (errno == ENOSYS) {
+                        have_openat2_ = false;
+                        break;
+                    }
+                    return -1;
+                }
+            }
+            return walk(dirfd, path, flags, mode);
+        }
+
+        // fallback for kernels < 5.6: emulates RESOLVE_BENEATH and
+        // RESOLVE_NO_SYMLINKS by opening one component after another
+        int dir_handle::walk(int dirfd, const char *path, int flags, mode_t mode)
+        {
+            if (*path == '/') {
+                errno = EXDEV;
+                return -1;
+            }
+            unique_fd cur;
+            int d = dirfd;
+            std::string comp;
+            const char *p = path;
+            for (;;) {
+                const char *e = strchr(p, '/');
+                if (!e) {
+                    if (!strcmp(p, "..")) {
+                        errno = EXDEV;
+                        return -1;
+                    }
+                    return ::openat(d, *p ? p : ".", flags | O_NOFOLLOW, mode);
+                }
+                comp.assign(p, e - p);
+                p = e + 1;
+                if (comp.empty() || comp == ".")
+                    continue;
+                if (comp == "..") {
+                    errno = EXDEV;
+                    return -1;
+                }
+                int r = ::openat(d, comp.c_str(),
+                        O_PATH | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+                if (r == -1)
+                    return -1;
+                cur.reset(r);
+                d = r;
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
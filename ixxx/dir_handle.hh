@@ -0,0 +1,77 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_DIR_HANDLE_HH
+#define IXXX_DIR_HANDLE_HH
+
+#include <ixxx/fd.hh>
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <sys/types.h>
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Opens files relative to a fixed root directory while caching
+        // the file descriptors of the directories they are located in,
+        // i.e. the kernel doesn't have to walk the same path prefixes
+        // over and over again.
+        //
+        // Paths are resolved with openat2() and RESOLVE_BENEATH |
+        // RESOLVE_NO_SYMLINKS (and RESOLVE_CACHED where possible), i.e.
+        // they can't escape the root directory and mustn't contain
+        // symbolic links. Absolute paths fail with EXDEV. On kernels
+        // without openat2() the path is walked component by component
+        // with openat() and O_NOFOLLOW.
+        //
+        // The cache is bounded and evicts the least recently used
+        // directory. When a lookup fails with ENOENT in a cached
+        // directory (e.g. because it was renamed) the entry is
+        // invalidated and the lookup is retried once.
+        class dir_handle {
+            public:
+                explicit dir_handle(const char *root, size_t max_cached = 64);
+                explicit dir_handle(const std::string &root, size_t max_cached = 64);
+                dir_handle(const dir_handle &) = delete;
+                dir_handle &operator=(const dir_handle &) = delete;
+
+                unique_fd open(const char *path, int flags, mode_t mode = 0);
+                unique_fd open(const std::string &path, int flags, mode_t mode = 0);
+
+                int fd() const;
+                size_t cached() const;
+                void invalidate(const std::string &dir);
+                void clear();
+            private:
+                struct entry {
+                    std::string dir;
+                    unique_fd fd;
+                };
+                typedef std::list<entry> lru_list;
+
+                int lookup(const std::string &dir, bool &hit);
+                int open_dir(const std::string &dir);
+                int resolve(int dirfd, const char *path, int flags, mode_t mode);
+                int walk(int dirfd, const char *path, int flags, mode_t mode);
+
+                unique_fd root_;
+                size_t max_;
+                lru_list lru_;
+                std::unordered_map<std::string, lru_list::iterator> index_;
+                bool have_openat2_ {true};
+                bool have_cached_ {true};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_DIR_HANDLE_HH
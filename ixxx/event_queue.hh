@@ -0,0 +1,156 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_EVENT_QUEUE_HH
+#define IXXX_EVENT_QUEUE_HH
+
+#include <ixxx/fd.hh>
+#include <ixxx/ring.hh>
+
+#include <atomic>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <ixxx/linux.hh>
+#include <ixxx/posix.hh>
+#include <ixxx/sys_error.hh>
+
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Bounded lock-free multi-producer single-consumer queue whose
+        // consumer sleeps on an eventfd, e.g. to hand work to a thread
+        // that runs an epoll loop.
+        //
+        // Producers only write to the eventfd when the consumer announced
+        // that it's about to sleep (prepare_wait()), i.e. under load the
+        // consumer keeps draining the queue and no syscalls are issued
+        // per message. Consumer loop:
+        //
+        //     for (;;) {
+        //         q.drain(f);
+        //         if (q.prepare_wait())
+        //             epoll_wait(...); // q.fd() registered with EPOLLIN
+        //         q.finish_wait();
+        //     }
+        template <typename T>
+        class event_queue {
+            public:
+                explicit event_queue(size_t capacity)
+                    : ring_(capacity),
+                      efd_(linux::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+                {
+                }
+                event_queue(const event_queue &) = delete;
+                event_queue &operator=(const event_queue &) = delete;
+
+                // readable after a producer woke the consumer
+                int fd() const { return efd_.get(); }
+                size_t capacity() const { return ring_.capacity(); }
+
+                // returns false if the queue is full
+                bool try_push(const T &x)
+                {
+                    T y(x);
+                    return try_push(std::move(y));
+                }
+                bool try_push(T &&x)
+                {
+                    if (!ring_.try_push(std::move(x)))
+                        return false;
+                    // pairs with the fence in prepare_wait(), i.e. either we
+                    // see the consumer going to sleep or it sees our item
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (sleeping_.load(std::memory_order_relaxed)
+                            && sleeping_.exchange(false, std::memory_order_relaxed)) {
+                        uint64_t v = 1;
+                        posix::write(efd_.get(), &v, sizeof v);
+                        wakeups_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    return true;
+                }
+
+                // must only be called by the consumer
+                bool try_pop(T &x) { return ring_.try_pop(x); }
+                // Pops up to max items and calls f(T&&) for each,
+                // returns the number of items.
+                // Must only be called by the consumer.
+                template <typename F>
+                size_t drain(F f, size_t max = SIZE_MAX)
+                {
+                    size_t n = 0;
+                    T x;
+                    while (n < max && ring_.try_pop(x)) {
+                        f(std::move(x));
+                        ++n;
+                    }
+                    return n;
+                }
+
+                // Announces that the consumer is about to sleep, returns
+                // false if items arrived in the meantime, i.e. when it
+                // must not sleep. Call finish_wait() in any case.
+                bool prepare_wait()
+                {
+                    sleeping_.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (!ring_.empty()) {
+                        sleeping_.store(false, std::memory_order_relaxed);
+                        return false;
+                    }
+                    return true;
+                }
+                // Resets the announcement and the eventfd after waking up.
+                void finish_wait()
+                {
+                    sleeping_.store(false, std::memory_order_relaxed);
+                    uint64_t v;
+                    if (::read(efd_.get(), &v, sizeof v) == -1 && errno != EAGAIN)
+                        throw read_error(errno);
+                }
+
+                // Sleeps until an item is pushed or timeout_ms (-1 means
+                // infinite) passed, i.e. for consumers without epoll loop.
+                void wait(int timeout_ms = -1)
+                {
+                    if (prepare_wait()) {
+                        struct pollfd p = { efd_.get(), POLLIN, 0 };
+                        posix::poll(&p, 1, timeout_ms);
+                    }
+                    finish_wait();
+                }
+
+                // number of eventfd writes, i.e. consumer wakeups
+                size_t wakeups() const
+                {
+                    return wakeups_.load(std::memory_order_relaxed);
+                }
+            private:
+                mpsc_ring<T> ring_;
+                unique_fd efd_;
+                // on its own cache line, as producers read it on each push
+                char pad0_[64];
+                std::atomic<bool> sleeping_ {false};
+                char pad1_[64];
+                std::atomic<size_t> wakeups_ {0};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_EVENT_QUEUE_HH
@@ -0,0 +1,116 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "fd.hh"
+
+#include "posix.hh"
+#include "linux.hh"
+#include "sys_error.hh"
+
+#include <vector>
+
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+
+#ifndef CLOSE_RANGE_CLOEXEC
+#define CLOSE_RANGE_CLOEXEC (1U << 2)
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+        unique_fd::unique_fd(int fd)
+            : fd_(fd)
+        {
+        }
+        unique_fd::~unique_fd()
+        {
+            if (fd_ != -1)
+                ::close(fd_);
+        }
+        unique_fd::unique_fd(unique_fd &&o) noexcept
+            : fd_(o.fd_)
+        {
+            o.fd_ = -1;
+        }
+        unique_fd &unique_fd::operator=(unique_fd &&o) noexcept
+        {
+            if (this != &o) {
+                if (fd_ != -1)
+                    ::close(fd_);
+                fd_ = o.fd_;
+                o.fd_ = -1;
+            }
+            return *this;
+        }
+        int unique_fd::release()
+        {
+            int r = fd_;
+            fd_ = -1;
+            return r;
+        }
+        void unique_fd::reset(int fd)
+        {
+            int old = fd_;
+            fd_ = fd;
+            if (old != -1 && old != fd)
+                posix::close(old);
+        }
+        void unique_fd::close()
+        {
+            reset();
+        }
+
+#if defined(__linux__)
+        static void close_from_proc(unsigned first, bool cloexec)
+        {
+            DIR *d = posix::opendir("/proc/self/fd");
+            int dfd = ::dirfd(d);
+            // collect first, since closing fds while reading the
+            // directory changes it
+            std::vector<int> fds;
+            try {
+                while (struct dirent *e = posix::readdir(d)) {
+                    if (*e->d_name == '.')
+                        continue;
+                    int fd = atoi(e->d_name);
+                    if (fd >= 0 && unsigned(fd) >= first && fd != dfd)
+                        fds.push_back(fd);
+                }
+            } catch (...) {
+                ::closedir(d);
+                throw;
+            }
+            posix::closedir(d);
+            for (int fd : fds) {
+                if (cloexec) {
+                    int flags = posix::fcntl(fd, F_GETFD, 0);
+                    posix::fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
+                } else {
+                    ::close(fd);
+                }
+            }
+        }
+
+        void close_from(unsigned first, bool cloexec)
+        {
+            try {
+                linux::close_range(first, ~0U, cloexec ? CLOSE_RANGE_CLOEXEC : 0);
+            } catch (const close_range_error &e) {
+                // ENOSYS: kernel < 5.9, EINVAL: CLOSE_RANGE_CLOEXEC
+                // not supported, i.e. kernel < 5.11
+                if (e.code() != ENOSYS && e.code() != EINVAL)
+                    throw;
+                close_from_proc(first, cloexec);
+            }
+        }
+#endif
+
+    }
+
+}
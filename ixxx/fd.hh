@@ -0,0 +1,55 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_FD_HH
+#define IXXX_FD_HH
+
+namespace ixxx {
+
+    namespace util {
+
+        // Owns a file descriptor, i.e. closes it on destruction.
+        //
+        // Example:
+        //
+        //     util::unique_fd fd(posix::open(filename, O_RDONLY));
+        //
+        // The destructor ignores close() errors - call close()
+        // explicitly where they matter (e.g. after writing).
+        class unique_fd {
+            public:
+                unique_fd() = default;
+                explicit unique_fd(int fd);
+                ~unique_fd();
+                unique_fd(const unique_fd &) = delete;
+                unique_fd &operator=(const unique_fd &) = delete;
+                unique_fd(unique_fd &&o) noexcept;
+                unique_fd &operator=(unique_fd &&o) noexcept;
+
+                int get() const { return fd_; }
+                explicit operator bool() const { return fd_ != -1; }
+
+                // gives up ownership
+                int release();
+                // closes the current fd (if any) and takes ownership of fd
+                void reset(int fd = -1);
+                void close();
+            private:
+                int fd_ {-1};
+        };
+
+#if defined(__linux__)
+        // Closes all file descriptors >= first, e.g. before spawning
+        // a child. With cloexec set they are just marked close-on-exec.
+        //
+        // Uses a single close_range() call and falls back to
+        // iterating /proc/self/fd on kernels that don't support it.
+        void close_from(unsigned first, bool cloexec = false);
+#endif
+
+    }
+
+}
+
+#endif // IXXX_FD_HH
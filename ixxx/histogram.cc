@@ -0,0 +1,107 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "histogram.hh"
+#include "timestamping.hh"
+
+#include <algorithm>
+
+namespace ixxx {
+
+    namespace util {
+
+        static const unsigned sub_bits = 4;
+        static const uint64_t sub_count = uint64_t(1) << sub_bits;
+        // values < sub_count map 1:1, then sub_count buckets for each
+        // further power of 2
+        static const size_t bucket_count = (64 - sub_bits + 1) * sub_count;
+
+        static unsigned msb(uint64_t v)
+        {
+            unsigned r = 0;
+            while (v >>= 1)
+                ++r;
+            return r;
+        }
+
+        latency_histogram::latency_histogram()
+            : buckets_(bucket_count)
+        {
+        }
+
+        size_t latency_histogram::bucket(uint64_t v)
+        {
+            if (v < sub_count)
+                return v;
+            unsigned e = msb(v) - sub_bits;
+            return (e + 1) * sub_count + ((v >> e) - sub_count);
+        }
+
+        uint64_t latency_histogram::bucket_max(size_t i)
+        {
+            if (i < sub_count)
+                return i;
+            unsigned e = i / sub_count - 1;
+            uint64_t m = i % sub_count + sub_count;
+            return ((m + 1) << e) - 1;
+        }
+
+        void latency_histogram::add(uint64_t v)
+        {
+            ++buckets_[bucket(v)];
+            ++count_;
+            sum_ += v;
+            min_ = std::min(min_, v);
+            max_ = std::max(max_, v);
+        }
+
+        void latency_histogram::add(const struct timespec &begin,
+                const struct timespec &end)
+        {
+            int64_t d = diff_ns(begin, end);
+            add(d < 0 ? 0 : uint64_t(d));
+        }
+
+        void latency_histogram::merge(const latency_histogram &o)
+        {
+            for (size_t i = 0; i < bucket_count; ++i)
+                buckets_[i] += o.buckets_[i];
+            count_ += o.count_;
+            sum_   += o.sum_;
+            min_ = std::min(min_, o.min_);
+            max_ = std::max(max_, o.max_);
+        }
+
+        void latency_histogram::clear()
+        {
+            std::fill(buckets_.begin(), buckets_.end(), 0);
+            count_ = 0;
+            sum_   = 0;
+            min_   = UINT64_MAX;
+            max_   = 0;
+        }
+
+        double latency_histogram::mean() const
+        {
+            return count_ ? double(sum_) / count_ : 0;
+        }
+
+        uint64_t latency_histogram::percentile(double p) const
+        {
+            if (!count_)
+                return 0;
+            uint64_t rank = p / 100 * count_ + 0.5;
+            rank = std::min(std::max(rank, uint64_t(1)), count_);
+            uint64_t n = 0;
+            for (size_t i = 0; i < bucket_count; ++i) {
+                n += buckets_[i];
+                if (n >= rank)
+                    return std::min(bucket_max(i), max_);
+            }
+            return max_;
+        }
+
+    }
+
+}
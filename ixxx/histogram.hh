@@ -0,0 +1,57 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_HISTOGRAM_HH
+#define IXXX_HISTOGRAM_HH
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <vector>
+
+namespace ixxx {
+
+    namespace util {
+
+        // Log-linear histogram of latencies (or any other non-negative
+        // integer values), i.e. each power of 2 range is split into 16
+        // linear sub-buckets. Thus, recording is O(1) without allocation
+        // and percentiles have a relative error of at most 1/16.
+        class latency_histogram {
+            public:
+                latency_histogram();
+
+                void add(uint64_t v);
+                // adds end - begin in nanoseconds (negative differences,
+                // e.g. due to clock adjustments, are counted as 0)
+                void add(const struct timespec &begin, const struct timespec &end);
+                void merge(const latency_histogram &o);
+                void clear();
+
+                uint64_t count() const { return count_; }
+                uint64_t min() const { return count_ ? min_ : 0; }
+                uint64_t max() const { return max_; }
+                double mean() const;
+                // upper bound of the bucket that contains the p-th
+                // percentile (0 <= p <= 100), capped at max()
+                uint64_t percentile(double p) const;
+
+                static size_t bucket(uint64_t v);
+                // largest value that falls into bucket i
+                static uint64_t bucket_max(size_t i);
+            private:
+                std::vector<uint64_t> buckets_;
+                uint64_t count_ {0};
+                uint64_t min_ {UINT64_MAX};
+                uint64_t max_ {0};
+                // sum might wrap for huge sample counts, good enough
+                // for the mean
+                uint64_t sum_ {0};
+        };
+
+    }
+
+}
+
+#endif // IXXX_HISTOGRAM_HH
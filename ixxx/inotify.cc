@@ -0,0 +1,80 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "inotify.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        inotify_watcher::inotify_watcher(size_t buffer_size)
+            : fd_(linux::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)),
+              // must be able to hold at least one event with maximal name
+              size_(std::max(buffer_size,
+                          sizeof(struct inotify_event) + NAME_MAX + 1)),
+              buf_(new char[size_])
+        {
+        }
+
+        int inotify_watcher::add(const char *pathname, uint32_t mask)
+        {
+            return linux::inotify_add_watch(fd_.get(), pathname, mask);
+        }
+        int inotify_watcher::add(const std::string &pathname, uint32_t mask)
+        {
+            return add(pathname.c_str(), mask);
+        }
+        void inotify_watcher::remove(int wd)
+        {
+            linux::inotify_rm_watch(fd_.get(), wd);
+        }
+
+        int inotify_watcher::fd() const
+        {
+            return fd_.get();
+        }
+        void inotify_watcher::attach(int epfd, uint64_t data)
+        {
+            struct epoll_event ev;
+            ev.events   = EPOLLIN;
+            ev.data.u64 = data;
+            linux::epoll_ctl(epfd, EPOLL_CTL_ADD, fd_.get(), &ev);
+        }
+        void inotify_watcher::detach(int epfd)
+        {
+            linux::epoll_ctl(epfd, EPOLL_CTL_DEL, fd_.get(), nullptr);
+        }
+
+        size_t inotify_watcher::fill()
+        {
+            for (;;) {
+                ssize_t r = ::read(fd_.get(), buf_.get(), size_);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN)
+                        return 0;
+                    throw read_error(errno);
+                }
+                return r;
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,89 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_INOTIFY_HH
+#define IXXX_INOTIFY_HH
+
+#include <ixxx/fd.hh>
+
+#include <memory>
+#include <string>
+#include <stdint.h>
+#include <sys/types.h>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Non-blocking inotify instance for event-driven invalidation,
+        // i.e. instead of polling files with stat().
+        //
+        // Pending events are read in large batches into a buffer that is
+        // allocated once and decoded in place, i.e. dispatching
+        // doesn't allocate.
+        //
+        // Example:
+        //
+        //     util::inotify_watcher w;
+        //     w.add("/etc/foo.conf", IN_CLOSE_WRITE | IN_MOVE_SELF);
+        //     w.attach(epfd, tag);
+        //     // on EPOLLIN for tag:
+        //     w.dispatch([](const struct inotify_event &e) { ... });
+        class inotify_watcher {
+            public:
+                explicit inotify_watcher(size_t buffer_size = 64 * 1024);
+
+                // returns the watch descriptor
+                int add(const char *pathname, uint32_t mask);
+                int add(const std::string &pathname, uint32_t mask);
+                void remove(int wd);
+
+                int fd() const;
+                // registers the inotify fd for EPOLLIN
+                void attach(int epfd, uint64_t data);
+                void detach(int epfd);
+
+                // calls f(const struct inotify_event &) for all pending events
+                // and returns the number of events
+                template <typename F> size_t dispatch(F f)
+                {
+                    size_t n = 0;
+                    for (;;) {
+                        size_t r = fill();
+                        if (!r)
+                            break;
+                        const char *p = buf_.get();
+                        const char *end = p + r;
+                        while (p < end) {
+                            const struct inotify_event *e =
+                                reinterpret_cast<const struct inotify_event*>(p);
+                            f(*e);
+                            ++n;
+                            p += sizeof(struct inotify_event) + e->len;
+                        }
+                    }
+                    return n;
+                }
+            private:
+                // returns 0 if no events are pending
+                size_t fill();
+
+                unique_fd fd_;
+                size_t size_;
+                std::unique_ptr<char[]> buf_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_INOTIFY_HH
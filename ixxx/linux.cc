@@ -6,9 +6,13 @@
 #include "sys_error.hh"
 
 #if defined(__linux__)
+#include <fcntl.h>
 #include <sys/prctl.h>
+#include <sys/socket.h>
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
+#include <sys/fanotify.h>
+#include <sys/inotify.h>
 #include <sys/signalfd.h>
 #include <sys/timerfd.h>
 #endif
@@ -24,6 +28,35 @@ namespace ixxx {
 
 #if defined(__linux__)
 
+    int accept4(int sockfd, struct sockaddr *addr, socklen_t *addrlen,
+            int flags)
+    {
+      int r = ::accept4(sockfd, addr, addrlen, flags);
+      if (r == -1)
+        throw accept4_error(errno);
+      return r;
+    }
+
+    void close_range(unsigned first, unsigned last, unsigned flags)
+    {
+#ifdef SYS_close_range
+      int r = ::syscall(SYS_close_range, first, last, flags);
+      if (r == -1)
+        throw close_range_error(errno);
+#else
+      throw close_range_error(ENOSYS);
+#endif
+    }
+
+    ssize_t copy_file_range(int fd_in, off_t *off_in, int fd_out,
+            off_t *off_out, size_t len, unsigned flags)
+    {
+      ssize_t r = ::copy_file_range(fd_in, off_in, fd_out, off_out, len, flags);
+      if (r == -1)
+        throw copy_file_range_error(errno);
+      return r;
+    }
+
     int epoll_create1(int flags)
     {
       int r = ::epoll_create1(flags);
@@ -44,6 +77,40 @@ namespace ixxx {
         throw epoll_wait_error(errno);
       return r;
     }
+    int epoll_pwait(int epfd, struct epoll_event *events, int maxevents,
+            int timeout, const sigset_t *sigmask)
+    {
+      int r = ::epoll_pwait(epfd, events, maxevents, timeout, sigmask);
+      if (r == -1)
+        throw epoll_pwait_error(errno);
+      return r;
+    }
+// __GLIBC_PREREQ() isn't defined by other libcs, i.e. it can't be
+// part of the same #if expression as the defined() check
+#ifdef __GLIBC__
+#if __GLIBC_PREREQ(2, 35)
+#define IXXX_GLIBC_EPOLL_PWAIT2
+#endif
+#endif
+    int epoll_pwait2(int epfd, struct epoll_event *events, int maxevents,
+            const struct timespec *timeout, const sigset_t *sigmask)
+    {
+#if defined(IXXX_GLIBC_EPOLL_PWAIT2)
+      int r = ::epoll_pwait2(epfd, events, maxevents, timeout, sigmask);
+      if (r == -1)
+        throw epoll_pwait2_error(errno);
+      return r;
+#elif defined(SYS_epoll_pwait2)
+      // the kernel expects the size of its sigset_t
+      int r = ::syscall(SYS_epoll_pwait2, epfd, events, maxevents, timeout,
+              sigmask, _NSIG / 8);
+      if (r == -1)
+        throw epoll_pwait2_error(errno);
+      return r;
+#else
+      throw epoll_pwait2_error(ENOSYS);
+#endif
+    }
 
     int eventfd(unsigned initval, int flags)
     {
@@ -53,6 +120,75 @@ namespace ixxx {
         return r;
     }
 
+    void fallocate(int fd, int mode, off_t offset, off_t len)
+    {
+      int r = ::fallocate(fd, mode, offset, len);
+      if (r == -1)
+        throw fallocate_error(errno);
+    }
+
+    int fanotify_init(unsigned flags, unsigned event_f_flags)
+    {
+      int r = ::fanotify_init(flags, event_f_flags);
+      if (r == -1)
+        throw fanotify_init_error(errno);
+      return r;
+    }
+    void fanotify_mark(int fd, unsigned flags, uint64_t mask, int dirfd,
+            const char *pathname)
+    {
+      int r = ::fanotify_mark(fd, flags, mask, dirfd, pathname);
+      if (r == -1)
+        throw fanotify_mark_error(errno);
+    }
+
+    int inotify_init1(int flags)
+    {
+      int r = ::inotify_init1(flags);
+      if (r == -1)
+        throw inotify_init1_error(errno);
+      return r;
+    }
+    int inotify_add_watch(int fd, const char *pathname, uint32_t mask)
+    {
+      int r = ::inotify_add_watch(fd, pathname, mask);
+      if (r == -1)
+        throw inotify_add_watch_error(errno);
+      return r;
+    }
+    int inotify_add_watch(int fd, const std::string &pathname, uint32_t mask)
+    {
+      return inotify_add_watch(fd, pathname.c_str(), mask);
+    }
+    void inotify_rm_watch(int fd, int wd)
+    {
+      int r = ::inotify_rm_watch(fd, wd);
+      if (r == -1)
+        throw inotify_rm_watch_error(errno);
+    }
+
+    int openat2(int dirfd, const char *pathname, struct open_how *how,
+            size_t size)
+    {
+#ifdef SYS_openat2
+      int r = ::syscall(SYS_openat2, dirfd, pathname, how, size);
+      if (r == -1)
+        throw openat2_error(errno);
+      return r;
+#else
+      throw openat2_error(ENOSYS);
+#endif
+    }
+
+    int ppoll(struct pollfd *fds, nfds_t nfds, const struct timespec *tmo_p,
+            const sigset_t *sigmask)
+    {
+      int r = ::ppoll(fds, nfds, tmo_p, sigmask);
+      if (r == -1)
+        throw ppoll_error(errno);
+      return r;
+    }
+
     int prctl(int option, unsigned long arg2, unsigned long arg3, unsigned long arg4, unsigned long arg5)
     {
       int r = ::prctl(option, arg2, arg3, arg4, arg5);
@@ -61,6 +197,30 @@ namespace ixxx {
       return r;
     }
 
+    int recvmmsg(int sockfd, struct mmsghdr *msgvec, unsigned vlen,
+            int flags, struct timespec *timeout)
+    {
+      int r = ::recvmmsg(sockfd, msgvec, vlen, flags, timeout);
+      if (r == -1)
+        throw recvmmsg_error(errno);
+      return r;
+    }
+    int sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned vlen,
+            int flags)
+    {
+      int r = ::sendmmsg(sockfd, msgvec, vlen, flags);
+      if (r == -1)
+        throw sendmmsg_error(errno);
+      return r;
+    }
+
+    void sched_getaffinity(pid_t pid, size_t cpusetsize, cpu_set_t *mask)
+    {
+        int r = ::sched_getaffinity(pid, cpusetsize, mask);
+        if (r == -1)
+            throw sched_getaffinity_error(errno);
+    }
+
     int signalfd(int fd, const sigset_t *mask, int flags)
     {
         int r = ::signalfd(fd, mask, flags);
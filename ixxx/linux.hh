@@ -7,8 +7,18 @@
 
 struct epoll_event;
 struct itimerspec;
+struct pollfd;
 
 #include <signal.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <string>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sched.h>
+#include <sys/socket.h>
+#endif
 
 
 // cf. /usr/include/linux/aio_abi.h
@@ -16,6 +26,8 @@ typedef unsigned long aio_context_t;
 struct iocb;
 struct io_event;
 struct timespec;
+struct open_how;
+struct mmsghdr;
 
 namespace ixxx {
 
@@ -28,15 +40,52 @@ namespace ixxx {
 
 #if defined(__linux__)
 
+      int accept4(int sockfd, struct sockaddr *addr, socklen_t *addrlen,
+              int flags);
+
+      void close_range(unsigned first, unsigned last, unsigned flags = 0);
+
+      ssize_t copy_file_range(int fd_in, off_t *off_in, int fd_out,
+              off_t *off_out, size_t len, unsigned flags = 0);
+
       int epoll_create1(int flags);
       void epoll_ctl(int epfd, int op, int fd, struct epoll_event *event);
       int epoll_wait(int epfd, struct epoll_event *events, int maxevents, int timeout);
+      int epoll_pwait(int epfd, struct epoll_event *events, int maxevents,
+              int timeout, const sigset_t *sigmask);
+      // requires Linux >= 5.11, throws ENOSYS otherwise
+      int epoll_pwait2(int epfd, struct epoll_event *events, int maxevents,
+              const struct timespec *timeout, const sigset_t *sigmask);
 
       int eventfd(unsigned initval, int flags);
 
+      void fallocate(int fd, int mode, off_t offset, off_t len);
+
+      int fanotify_init(unsigned flags, unsigned event_f_flags);
+      void fanotify_mark(int fd, unsigned flags, uint64_t mask, int dirfd,
+              const char *pathname);
+
+      int inotify_init1(int flags);
+      int inotify_add_watch(int fd, const char *pathname, uint32_t mask);
+      int inotify_add_watch(int fd, const std::string &pathname, uint32_t mask);
+      void inotify_rm_watch(int fd, int wd);
+
+      int openat2(int dirfd, const char *pathname, struct open_how *how,
+              size_t size);
+
+      int ppoll(struct pollfd *fds, nfds_t nfds, const struct timespec *tmo_p,
+              const sigset_t *sigmask);
+
     int prctl(int option, unsigned long arg2, unsigned long arg3 = 0,
         unsigned long arg4 = 0, unsigned long arg5 = 0);
 
+      int recvmmsg(int sockfd, struct mmsghdr *msgvec, unsigned vlen,
+              int flags, struct timespec *timeout = nullptr);
+      int sendmmsg(int sockfd, struct mmsghdr *msgvec, unsigned vlen,
+              int flags);
+
+      void sched_getaffinity(pid_t pid, size_t cpusetsize, cpu_set_t *mask);
+
       int signalfd(int fd, const sigset_t *mask, int flags);
 
       int timerfd_create(int clockid, int flags);
@@ -0,0 +1,150 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "mmsg.hh"
+
+#if defined(__linux__)
+
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <string.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        mmsg_batch::mmsg_batch(size_t n, size_t msg_size)
+            : n_(n),
+              msg_size_(msg_size),
+              msgs_(new struct mmsghdr[n]()),
+              iovs_(new struct iovec[n]()),
+              addrs_(new struct sockaddr_storage[n]()),
+              bufs_(new char[n * msg_size])
+        {
+            for (size_t i = 0; i < n_; ++i) {
+                iovs_[i].iov_base = bufs_.get() + i * msg_size_;
+                iovs_[i].iov_len  = msg_size_;
+                struct msghdr &h = msgs_[i].msg_hdr;
+                h.msg_iov    = &iovs_[i];
+                h.msg_iovlen = 1;
+                h.msg_name   = &addrs_[i];
+            }
+        }
+
+        size_t mmsg_batch::recv(int fd, int flags)
+        {
+            sent_ = count_ = 0;
+            for (size_t i = 0; i < n_; ++i) {
+                iovs_[i].iov_len = msg_size_;
+                msgs_[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_storage);
+                msgs_[i].msg_hdr.msg_flags   = 0;
+            }
+            for (;;) {
+                int r = ::recvmmsg(fd, msgs_.get(), n_, flags, nullptr);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return 0;
+                    throw recvmmsg_error(errno);
+                }
+                count_ = r;
+                return count_;
+            }
+        }
+
+        const char *mmsg_batch::data(size_t i) const
+        {
+            return bufs_.get() + i * msg_size_;
+        }
+        size_t mmsg_batch::length(size_t i) const
+        {
+            return msgs_[i].msg_len;
+        }
+        bool mmsg_batch::truncated(size_t i) const
+        {
+            return msgs_[i].msg_hdr.msg_flags & MSG_TRUNC;
+        }
+        const struct sockaddr_storage &mmsg_batch::addr(size_t i) const
+        {
+            return addrs_[i];
+        }
+        socklen_t mmsg_batch::addrlen(size_t i) const
+        {
+            return msgs_[i].msg_hdr.msg_namelen;
+        }
+
+        char *mmsg_batch::prepare()
+        {
+            if (count_ == n_)
+                return nullptr;
+            return bufs_.get() + count_ * msg_size_;
+        }
+        void mmsg_batch::commit(size_t len, const struct sockaddr *dst,
+                socklen_t dstlen)
+        {
+            if (count_ == n_)
+                throw sendmmsg_error(ENOBUFS, "batch is full");
+            if (len > msg_size_ || dstlen > sizeof(struct sockaddr_storage))
+                throw sendmmsg_error(EMSGSIZE);
+            iovs_[count_].iov_len = len;
+            struct msghdr &h = msgs_[count_].msg_hdr;
+            if (dst) {
+                memcpy(&addrs_[count_], dst, dstlen);
+                h.msg_name    = &addrs_[count_];
+                h.msg_namelen = dstlen;
+            } else {
+                h.msg_name    = nullptr;
+                h.msg_namelen = 0;
+            }
+            ++count_;
+        }
+        bool mmsg_batch::push(const void *p, size_t len,
+                const struct sockaddr *dst, socklen_t dstlen)
+        {
+            char *b = prepare();
+            if (!b)
+                return false;
+            if (len > msg_size_)
+                throw sendmmsg_error(EMSGSIZE);
+            memcpy(b, p, len);
+            commit(len, dst, dstlen);
+            return true;
+        }
+
+        size_t mmsg_batch::send(int fd, int flags)
+        {
+            size_t n = 0;
+            while (sent_ < count_) {
+                int r = ::sendmmsg(fd, msgs_.get() + sent_, count_ - sent_, flags);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return n;
+                    throw sendmmsg_error(errno);
+                }
+                sent_ += r;
+                n += r;
+            }
+            clear();
+            return n;
+        }
+
+        void mmsg_batch::clear()
+        {
+            for (size_t i = 0; i < count_; ++i) {
+                struct msghdr &h = msgs_[i].msg_hdr;
+                h.msg_name    = &addrs_[i];
+                iovs_[i].iov_len = msg_size_;
+            }
+            count_ = sent_ = 0;
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,87 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_MMSG_HH
+#define IXXX_MMSG_HH
+
+#include <memory>
+#include <stddef.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Preallocated batch of datagrams for sendmmsg()/recvmmsg(),
+        // i.e. the mmsghdr, iovec and address arrays and the payload
+        // buffers are allocated once and reused across calls.
+        //
+        // A batch is either used for receiving or for sending.
+        class mmsg_batch {
+            public:
+                // n messages of up to msg_size bytes each
+                mmsg_batch(size_t n, size_t msg_size);
+                mmsg_batch(const mmsg_batch &) = delete;
+                mmsg_batch &operator=(const mmsg_batch &) = delete;
+
+                size_t capacity() const { return n_; }
+                size_t msg_size() const { return msg_size_; }
+                // number of received or queued messages
+                size_t size() const { return count_; }
+
+                // Receives up to capacity() messages in one call.
+                // Returns the number of received messages, i.e. 0 if none
+                // are available (EAGAIN) on a non-blocking socket
+                // (or with MSG_DONTWAIT). NB: on a blocking socket
+                // recvmmsg() waits for capacity() messages unless
+                // MSG_WAITFORONE is passed.
+                size_t recv(int fd, int flags = 0);
+
+                const char *data(size_t i) const;
+                size_t length(size_t i) const;
+                // i.e. the message didn't fit into msg_size() bytes
+                bool truncated(size_t i) const;
+                const struct sockaddr_storage &addr(size_t i) const;
+                socklen_t addrlen(size_t i) const;
+
+                // Returns a buffer of msg_size() bytes for the next
+                // outgoing message, the message is queued with commit().
+                // Returns nullptr if the batch is full.
+                char *prepare();
+                void commit(size_t len, const struct sockaddr *dst = nullptr,
+                        socklen_t dstlen = 0);
+                // copies the message, returns false if the batch is full
+                bool push(const void *p, size_t len,
+                        const struct sockaddr *dst = nullptr, socklen_t dstlen = 0);
+
+                // Sends the queued messages, returns the number of messages
+                // sent in this call. On a non-blocking socket some messages
+                // might remain pending, i.e. call send() again later.
+                size_t send(int fd, int flags = 0);
+                size_t pending() const { return count_ - sent_; }
+
+                void clear();
+            private:
+                size_t n_;
+                size_t msg_size_;
+                size_t count_ {0};
+                size_t sent_ {0};
+                std::unique_ptr<struct mmsghdr[]> msgs_;
+                std::unique_ptr<struct iovec[]> iovs_;
+                std::unique_ptr<struct sockaddr_storage[]> addrs_;
+                std::unique_ptr<char[]> bufs_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_MMSG_HH
@@ -0,0 +1,116 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "packet_ring.hh"
+
+#if defined(__linux__)
+
+#include "posix.hh"
+#include "socket.hh"
+#include "sys_error.hh"
+
+#include <string.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <net/if.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        packet_ring::packet_ring(const char *ifname, unsigned block_size,
+                unsigned block_count, unsigned frame_size,
+                unsigned retire_timeout_ms, unsigned protocol)
+            : fd_(posix::socket(AF_PACKET, SOCK_RAW | SOCK_CLOEXEC, 0)),
+              block_size_(block_size),
+              block_count_(block_count)
+        {
+            int version = TPACKET_V3;
+            posix::setsockopt(fd_.get(), SOL_PACKET, PACKET_VERSION,
+                    &version, sizeof version);
+
+            struct tpacket_req3 req;
+            memset(&req, 0, sizeof req);
+            req.tp_block_size       = block_size;
+            req.tp_block_nr         = block_count;
+            req.tp_frame_size       = frame_size;
+            req.tp_frame_nr         = frame_size
+                ? size_t(block_size) * block_count / frame_size : 0;
+            req.tp_retire_blk_tov   = retire_timeout_ms;
+            req.tp_feature_req_word = TP_FT_REQ_FILL_RXHASH;
+            posix::setsockopt(fd_.get(), SOL_PACKET, PACKET_RX_RING,
+                    &req, sizeof req);
+
+            size_ = size_t(block_size) * block_count;
+            ring_ = static_cast<unsigned char*>(posix::mmap(nullptr, size_,
+                        PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        fd_.get(), 0));
+
+            // The socket was created with protocol 0, i.e. it doesn't
+            // receive anything until the protocol is set here together
+            // with the interface. Thus, the ring doesn't start with frames
+            // of other interfaces.
+            try {
+                struct sockaddr_ll addr;
+                memset(&addr, 0, sizeof addr);
+                addr.sll_family   = AF_PACKET;
+                addr.sll_protocol = htons(protocol);
+                addr.sll_ifindex  = ifname ? posix::if_nametoindex(ifname) : 0;
+                posix::bind(fd_.get(), reinterpret_cast<struct sockaddr*>(&addr),
+                        sizeof addr);
+            } catch (...) {
+                ::munmap(ring_, size_);
+                throw;
+            }
+        }
+
+        packet_ring::~packet_ring()
+        {
+            ::munmap(ring_, size_);
+        }
+
+        bool packet_ring::wait(int timeout_ms)
+        {
+            if (current())
+                return true;
+            struct pollfd p = { fd_.get(), POLLIN | POLLERR, 0 };
+            return posix::poll(&p, 1, timeout_ms) == 1;
+        }
+
+        struct tpacket_block_desc *packet_ring::current()
+        {
+            struct tpacket_block_desc *b =
+                reinterpret_cast<struct tpacket_block_desc*>(
+                        ring_ + size_t(idx_) * block_size_);
+            // pairs with the kernel's release of the block
+            if (__atomic_load_n(&b->hdr.bh1.block_status, __ATOMIC_ACQUIRE)
+                    & TP_STATUS_USER)
+                return b;
+            return nullptr;
+        }
+
+        void packet_ring::release(struct tpacket_block_desc *b)
+        {
+            __atomic_store_n(&b->hdr.bh1.block_status, TP_STATUS_KERNEL,
+                    __ATOMIC_RELEASE);
+            idx_ = (idx_ + 1) % block_count_;
+        }
+
+        packet_ring::stats packet_ring::statistics()
+        {
+            struct tpacket_stats_v3 s;
+            memset(&s, 0, sizeof s);
+            socklen_t n = sizeof s;
+            posix::getsockopt(fd_.get(), SOL_PACKET, PACKET_STATISTICS, &s, &n);
+            stats r = { s.tp_packets, s.tp_drops, s.tp_freeze_q_cnt };
+            return r;
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,122 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_PACKET_RING_HH
+#define IXXX_PACKET_RING_HH
+
+#include <ixxx/fd.hh>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/if_packet.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // A frame as seen by packet_ring::dispatch(), data points
+        // into the ring, i.e. it's only valid during the callback.
+        struct packet {
+            const unsigned char *data;
+            // captured length
+            uint32_t length;
+            // length on the wire
+            uint32_t wire_length;
+            struct timespec ts;
+        };
+
+        // Captures frames via an AF_PACKET socket with a memory mapped
+        // TPACKET_V3 receive ring, i.e. the kernel fills whole blocks of
+        // frames and passes them to user space by flipping the block
+        // status. Frames are thus read in place without any copying and
+        // without a syscall per frame.
+        //
+        // The socket only signals readability (poll/epoll) when a block
+        // is retired, i.e. when it's full or the retire timeout expired.
+        //
+        // Requires CAP_NET_RAW (e.g. root in a user/network namespace).
+        class packet_ring {
+            public:
+                // ifname == nullptr captures on all interfaces,
+                // protocol is an ETH_P_* value in host byte order,
+                // retire_timeout_ms == 0 lets the kernel choose
+                explicit packet_ring(const char *ifname = nullptr,
+                        unsigned block_size = 1u << 20,
+                        unsigned block_count = 16,
+                        unsigned frame_size = 2048,
+                        unsigned retire_timeout_ms = 10,
+                        unsigned protocol = 0x0003 /* ETH_P_ALL */);
+                ~packet_ring();
+                packet_ring(const packet_ring &) = delete;
+                packet_ring &operator=(const packet_ring &) = delete;
+
+                int fd() const { return fd_.get(); }
+
+                // waits until a block is retired,
+                // returns false on timeout
+                bool wait(int timeout_ms);
+
+                // Calls f(const packet &) for each frame of the retired
+                // blocks and returns those to the kernel.
+                // Returns the number of frames.
+                template <typename F>
+                size_t dispatch(F f)
+                {
+                    size_t n = 0;
+                    while (struct tpacket_block_desc *b = current()) {
+                        const unsigned char *p =
+                            reinterpret_cast<const unsigned char*>(b)
+                            + b->hdr.bh1.offset_to_first_pkt;
+                        for (uint32_t i = 0; i < b->hdr.bh1.num_pkts; ++i) {
+                            const struct tpacket3_hdr *h =
+                                reinterpret_cast<const struct tpacket3_hdr*>(p);
+                            packet x;
+                            x.data        = p + h->tp_mac;
+                            x.length      = h->tp_snaplen;
+                            x.wire_length = h->tp_len;
+                            x.ts.tv_sec   = h->tp_sec;
+                            x.ts.tv_nsec  = h->tp_nsec;
+                            f(x);
+                            p += h->tp_next_offset;
+                        }
+                        n += b->hdr.bh1.num_pkts;
+                        release(b);
+                    }
+                    return n;
+                }
+
+                // cumulative since the last call (cf. PACKET_STATISTICS)
+                struct stats {
+                    unsigned packets;
+                    unsigned drops;
+                    // number of times the ring was full
+                    unsigned freezes;
+                };
+                stats statistics();
+            private:
+                // next retired block or nullptr
+                struct tpacket_block_desc *current();
+                void release(struct tpacket_block_desc *b);
+
+                unique_fd fd_;
+                unsigned char *ring_ {nullptr};
+                size_t size_ {0};
+                unsigned block_size_;
+                unsigned block_count_;
+                unsigned idx_ {0};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_PACKET_RING_HH
@@ -17,6 +17,7 @@
     #include <windows.h>
 #else
     #include <sys/mman.h>
+    #include <sys/ioctl.h>
 #endif
 #include <signal.h>
 #include <pwd.h>
@@ -209,6 +210,15 @@ namespace ixxx {
         throw gmtime_r_error(errno, "Year doesn't fit into integer");
       return r;
     }
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    int ioctl(int fd, unsigned long request, void *arg)
+    {
+      int r = ::ioctl(fd, request, arg);
+      if (r == -1)
+        throw ioctl_error(errno);
+      return r;
+    }
+#endif
     int isatty(int fd)
     {
       int r = ::isatty(fd);
@@ -330,6 +340,12 @@ namespace ixxx {
         throw mmap_error(errno);
       return r;
     }
+    void mprotect(void *addr, size_t len, int prot)
+    {
+        int r = ::mprotect(addr, len, prot);
+        if (r == -1)
+            throw mprotect_error(errno);
+    }
     void msync(void *addr, size_t length, int flags)
     {
         int r = ::msync(addr, length, flags);
@@ -69,6 +69,9 @@ namespace ixxx {
             char *buf, size_t buflen, struct passwd **result);
 
     struct tm *gmtime_r(const time_t *timep, struct tm *result);
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    int ioctl(int fd, unsigned long request, void *arg);
+#endif
     int isatty(int fd);
 #if (defined(__MINGW32__) || defined(__MINGW64__))
 #else
@@ -109,6 +112,7 @@ namespace ixxx {
 #else
     void *mmap(void *addr, size_t length, int prot, int flags,
         int fd, off_t offset);
+    void mprotect(void *addr, size_t len, int prot);
     void msync(void *addr, size_t length, int flags);
     void munmap(void *addr, size_t length);
 #endif
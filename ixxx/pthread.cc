@@ -24,6 +24,13 @@ namespace ixxx {
                 throw pthread_join_error(r);
         }
 
+        void pthread_sigmask(int how, const sigset_t *set, sigset_t *oldset)
+        {
+            int r = ::pthread_sigmask(how, set, oldset);
+            if (r)
+                throw pthread_sigmask_error(r);
+        }
+
         void pthread_attr_init(pthread_attr_t *attr)
         {
             int r = ::pthread_attr_init(attr);
@@ -66,6 +73,35 @@ namespace ixxx {
             if (r)
                 throw pthread_attr_setinheritsched_error(r);
         }
+        void pthread_attr_setstacksize(pthread_attr_t *attr,
+                size_t stacksize)
+        {
+            int r = ::pthread_attr_setstacksize(attr, stacksize);
+            if (r)
+                throw pthread_attr_setstacksize_error(r);
+        }
+        void pthread_attr_setguardsize(pthread_attr_t *attr,
+                size_t guardsize)
+        {
+            int r = ::pthread_attr_setguardsize(attr, guardsize);
+            if (r)
+                throw pthread_attr_setguardsize_error(r);
+        }
+        void pthread_attr_setstack(pthread_attr_t *attr,
+                void *stackaddr, size_t stacksize)
+        {
+            int r = ::pthread_attr_setstack(attr, stackaddr, stacksize);
+            if (r)
+                throw pthread_attr_setstack_error(r);
+        }
+#if defined(__linux__)
+        void pthread_setname_np(pthread_t thread, const char *name)
+        {
+            int r = ::pthread_setname_np(thread, name);
+            if (r)
+                throw pthread_setname_np_error(r);
+        }
+#endif
 
 
     }
@@ -7,6 +7,7 @@
 
 
 #include <pthread.h>
+#include <signal.h>
 
 namespace ixxx {
 
@@ -16,6 +17,8 @@ namespace ixxx {
                 void *(*start_routine) (void *), void *arg);
         void pthread_join(pthread_t thread, void **retval);
 
+        void pthread_sigmask(int how, const sigset_t *set, sigset_t *oldset);
+
         void pthread_attr_init(pthread_attr_t *attr);
         void pthread_attr_destroy(pthread_attr_t *attr);
 
@@ -28,6 +31,15 @@ namespace ixxx {
                 const struct sched_param *param);
         void pthread_attr_setinheritsched(pthread_attr_t *attr,
                 int inheritsched);
+        void pthread_attr_setstacksize(pthread_attr_t *attr,
+                size_t stacksize);
+        void pthread_attr_setguardsize(pthread_attr_t *attr,
+                size_t guardsize);
+        void pthread_attr_setstack(pthread_attr_t *attr,
+                void *stackaddr, size_t stacksize);
+#if defined(__linux__)
+        void pthread_setname_np(pthread_t thread, const char *name);
+#endif
 
 
     }
@@ -0,0 +1,156 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "reactor.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+
+#include <errno.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        reactor::reactor(size_t initial_events, size_t max_events)
+            : epfd_(linux::epoll_create1(EPOLL_CLOEXEC)),
+              events_(std::max(initial_events, size_t(1))),
+              max_events_(std::max(max_events, events_.size()))
+        {
+            graveyard_.reserve(16);
+        }
+
+        uint64_t reactor::pack(int fd, uint32_t gen)
+        {
+            return uint64_t(gen) << 32 | uint32_t(fd);
+        }
+
+        reactor::slot *reactor::find(int fd) const
+        {
+            size_t i = size_t(fd) >> page_bits;
+            if (fd < 0 || i >= pages_.size())
+                return nullptr;
+            return &pages_[i][fd & (page_size - 1)];
+        }
+
+        reactor::slot &reactor::active_slot(int fd)
+        {
+            slot *s = find(fd);
+            if (!s || !s->active)
+                throw epoll_ctl_error(ENOENT);
+            return *s;
+        }
+
+        bool reactor::contains(int fd) const
+        {
+            slot *s = find(fd);
+            return s && s->active;
+        }
+
+        void reactor::add(int fd, uint32_t events, handler h)
+        {
+            if (fd < 0)
+                throw epoll_ctl_error(EBADF);
+            while (size_t(fd) >> page_bits >= pages_.size())
+                pages_.emplace_back(new slot[page_size]);
+            slot &s = *find(fd);
+            if (s.active)
+                throw epoll_ctl_error(EEXIST);
+            std::unique_ptr<handler> p(new handler(std::move(h)));
+            struct epoll_event ev;
+            ev.events   = events;
+            ev.data.u64 = pack(fd, s.gen);
+            linux::epoll_ctl(epfd_.get(), EPOLL_CTL_ADD, fd, &ev);
+            s.h      = std::move(p);
+            s.events = events;
+            s.active = true;
+            ++count_;
+        }
+
+        void reactor::modify(int fd, uint32_t events)
+        {
+            slot &s = active_slot(fd);
+            struct epoll_event ev;
+            ev.events   = events;
+            ev.data.u64 = pack(fd, s.gen);
+            linux::epoll_ctl(epfd_.get(), EPOLL_CTL_MOD, fd, &ev);
+            s.events = events;
+        }
+
+        void reactor::rearm(int fd)
+        {
+            slot &s = active_slot(fd);
+            struct epoll_event ev;
+            ev.events   = s.events;
+            ev.data.u64 = pack(fd, s.gen);
+            linux::epoll_ctl(epfd_.get(), EPOLL_CTL_MOD, fd, &ev);
+        }
+
+        void reactor::remove(int fd)
+        {
+            slot &s = active_slot(fd);
+            // first, i.e. the state is unchanged if it throws
+            struct epoll_event ev = epoll_event();
+            linux::epoll_ctl(epfd_.get(), EPOLL_CTL_DEL, fd, &ev);
+            s.active = false;
+            // invalidates events of this batch that are still to be
+            // dispatched
+            ++s.gen;
+            --count_;
+            if (dispatching_)
+                graveyard_.push_back(std::move(s.h));
+            else
+                s.h.reset();
+        }
+
+        size_t reactor::run_once(int timeout_ms)
+        {
+            int n = ::epoll_wait(epfd_.get(), events_.data(), events_.size(),
+                    timeout_ms);
+            if (n == -1) {
+                if (errno == EINTR)
+                    return 0;
+                throw epoll_wait_error(errno);
+            }
+            size_t k = 0;
+            dispatching_ = true;
+            try {
+                for (int i = 0; i < n; ++i) {
+                    uint64_t d = events_[i].data.u64;
+                    int fd = int(uint32_t(d));
+                    slot &s = *find(fd);
+                    if (!s.active || s.gen != uint32_t(d >> 32))
+                        continue;
+                    (*s.h)(fd, events_[i].events);
+                    ++k;
+                }
+            } catch (...) {
+                dispatching_ = false;
+                graveyard_.clear();
+                throw;
+            }
+            dispatching_ = false;
+            graveyard_.clear();
+            if (size_t(n) == events_.size() && events_.size() < max_events_)
+                events_.resize(std::min(events_.size() * 2, max_events_));
+            return k;
+        }
+
+        void reactor::run()
+        {
+            while (!stop_)
+                run_once();
+            // i.e. run() can be called again
+            stop_ = false;
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,111 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_REACTOR_HH
+#define IXXX_REACTOR_HH
+
+#include <ixxx/fd.hh>
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Epoll event loop with handlers stored in a dense table
+        // that is indexed by file descriptor. The table is allocated in
+        // pages, thus slots don't move when it grows (e.g. when a handler
+        // adds descriptors).
+        //
+        // Each registration carries a generation counter in the epoll
+        // user data, thus events that were already fetched for a
+        // descriptor that is removed (or removed and re-added) during
+        // dispatch are dropped instead of being delivered to the wrong
+        // handler.
+        //
+        // The events array grows with the load (up to max_events), i.e.
+        // after warm-up neither waiting nor dispatching allocates (only
+        // add() does).
+        //
+        // For edge-triggered one-shot registrations pass
+        // EPOLLET | EPOLLONESHOT and call rearm() after the descriptor
+        // was drained.
+        class reactor {
+            public:
+                typedef std::function<void(int fd, uint32_t events)> handler;
+
+                explicit reactor(size_t initial_events = 64,
+                        size_t max_events = 4096);
+                reactor(const reactor &) = delete;
+                reactor &operator=(const reactor &) = delete;
+
+                // the epoll descriptor, e.g. for nesting into another loop
+                int fd() const { return epfd_.get(); }
+
+                void add(int fd, uint32_t events, handler h);
+                void modify(int fd, uint32_t events);
+                // re-enables a one-shot registration with its events
+                void rearm(int fd);
+                // Safe to call from any handler, also for the descriptor
+                // that is currently dispatched. Must be called before the
+                // descriptor is closed.
+                void remove(int fd);
+                bool contains(int fd) const;
+                // number of registered descriptors
+                size_t size() const { return count_; }
+
+                // Waits (at most timeout_ms, -1 means infinite) and
+                // dispatches one batch of events, returns the number of
+                // dispatched events. Returns 0 when interrupted by a signal.
+                size_t run_once(int timeout_ms = -1);
+                // Calls run_once() until stop() is called. Returns
+                // immediately if stop() was called before.
+                void run();
+                void stop() { stop_ = true; }
+
+                size_t events_capacity() const { return events_.size(); }
+            private:
+                struct slot {
+                    // heap allocated, i.e. a running handler isn't
+                    // moved when its descriptor is removed and re-added
+                    std::unique_ptr<handler> h;
+                    uint32_t events {0};
+                    uint32_t gen {0};
+                    bool active {false};
+                };
+                enum { page_bits = 8, page_size = 1 << page_bits };
+                static uint64_t pack(int fd, uint32_t gen);
+                // nullptr if fd is beyond the table
+                slot *find(int fd) const;
+                slot &active_slot(int fd);
+
+                unique_fd epfd_;
+                std::vector<std::unique_ptr<slot[]>> pages_;
+                std::vector<struct epoll_event> events_;
+                size_t max_events_;
+                size_t count_ {0};
+                bool dispatching_ {false};
+                // handlers removed during dispatch are destroyed afterwards,
+                // i.e. not while they might be executing
+                std::vector<std::unique_ptr<handler>> graveyard_;
+                bool stop_ {false};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_REACTOR_HH
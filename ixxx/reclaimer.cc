@@ -0,0 +1,130 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "reclaimer.hh"
+
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+
+#include "posix.hh"
+#include "sys_error.hh"
+
+namespace ixxx {
+
+    namespace util {
+
+        reclaimer::reclaimer(size_t capacity, error_callback on_error)
+            : on_error_(on_error),
+              queue_(capacity)
+        {
+            thread_ = std::thread(&reclaimer::run, this);
+        }
+        reclaimer::~reclaimer()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            work_cv_.notify_one();
+            thread_.join();
+        }
+
+        void reclaimer::close(int fd)
+        {
+            item x = { close_fd, nullptr, 0, fd };
+            push(x);
+        }
+        void reclaimer::munmap(void *addr, size_t length)
+        {
+            item x = { unmap, addr, length, -1 };
+            push(x);
+        }
+
+        void reclaimer::push(const item &x)
+        {
+            if (!queue_.try_push(x)) {
+                execute(x);
+                return;
+            }
+            // pairs with the fence in run(), i.e. either we see the
+            // consumer going to sleep or it sees our item
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleeping_.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                work_cv_.notify_one();
+            }
+        }
+
+        void reclaimer::execute(const item &x)
+        {
+            try {
+                switch (x.type) {
+                    case close_fd:
+                        posix::close(x.fd);
+                        break;
+                    case unmap:
+                        posix::munmap(x.addr, x.length);
+                        break;
+                    case flush_marker:
+                        {
+                            std::lock_guard<std::mutex> lock(mutex_);
+                            *static_cast<bool*>(x.addr) = true;
+                            done_cv_.notify_all();
+                        }
+                        return;
+                }
+            } catch (const sys_error &e) {
+                errors_.fetch_add(1, std::memory_order_relaxed);
+                if (on_error_)
+                    on_error_(e);
+            }
+            completed_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void reclaimer::run()
+        {
+            item x;
+            for (;;) {
+                while (queue_.try_pop(x))
+                    execute(x);
+
+                std::unique_lock<std::mutex> lock(mutex_);
+                sleeping_.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                work_cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+                sleeping_.store(false, std::memory_order_relaxed);
+                if (stop_ && queue_.empty())
+                    break;
+            }
+        }
+
+        void reclaimer::flush()
+        {
+            // The queue is FIFO, thus, once the marker is executed, all
+            // requests that were enqueued before it are executed, too -
+            // independent of how many producers there are.
+            bool done = false;
+            item x = { flush_marker, &done, 0, -1 };
+            while (!queue_.try_push(x))
+                std::this_thread::yield();
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (sleeping_.load(std::memory_order_relaxed))
+                work_cv_.notify_one();
+            done_cv_.wait(lock, [&done]() { return done; });
+        }
+
+        size_t reclaimer::completed() const
+        {
+            return completed_.load(std::memory_order_relaxed);
+        }
+        size_t reclaimer::errors() const
+        {
+            return errors_.load(std::memory_order_relaxed);
+        }
+
+    }
+
+}
+
+#endif
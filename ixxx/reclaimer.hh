@@ -0,0 +1,91 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_RECLAIMER_HH
+#define IXXX_RECLAIMER_HH
+
+#include <ixxx/ring.hh>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <stddef.h>
+
+namespace ixxx {
+
+    class sys_error;
+
+    namespace util {
+
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+
+        // Executes close() and munmap() calls on a background thread,
+        // e.g. because tearing down a multi-GB mapping or a socket with
+        // large queues may stall the calling thread for milliseconds.
+        //
+        // Requests are passed via a lock-free queue, i.e. the hot path
+        // just enqueues and only notifies the background thread if it
+        // is about to sleep. If the queue is full the call is executed
+        // synchronously.
+        //
+        // Since errors can't be thrown to the caller, they are counted
+        // and passed to the optional error callback. It's called on the
+        // background thread - or on the calling thread when the queue
+        // was full.
+        class reclaimer {
+            public:
+                typedef std::function<void(const sys_error &)> error_callback;
+
+                explicit reclaimer(size_t capacity = 4096,
+                        error_callback on_error = error_callback());
+                // flushes pending requests
+                ~reclaimer();
+                reclaimer(const reclaimer &) = delete;
+                reclaimer &operator=(const reclaimer &) = delete;
+
+                void close(int fd);
+                void munmap(void *addr, size_t length);
+
+                // Blocks until all requests enqueued so far are executed,
+                // including the ones of other threads whose close()/munmap()
+                // calls returned before.
+                void flush();
+
+                // number of executed close()/munmap() calls
+                size_t completed() const;
+                size_t errors() const;
+            private:
+                enum kind { close_fd, unmap, flush_marker };
+                struct item {
+                    kind type;
+                    // flush marker: its done flag
+                    void *addr;
+                    size_t length;
+                    int fd;
+                };
+                void push(const item &x);
+                void execute(const item &x);
+                void run();
+
+                error_callback on_error_;
+                mpsc_ring<item> queue_;
+                std::atomic<size_t> completed_ {0};
+                std::atomic<size_t> errors_ {0};
+                std::atomic<bool> sleeping_ {false};
+                bool stop_ {false};
+                std::mutex mutex_;
+                std::condition_variable work_cv_;
+                std::condition_variable done_cv_;
+                std::thread thread_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_RECLAIMER_HH
@@ -0,0 +1,250 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "resolver.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "posix.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/eventfd.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        const char *resolve_result::what() const
+        {
+            return gai_strerror(error);
+        }
+
+        resolver::resolver(unsigned threads, size_t max_entries,
+                std::chrono::milliseconds ttl,
+                std::chrono::milliseconds negative_ttl)
+            : efd_(linux::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+              max_entries_(max_entries),
+              ttl_(ttl),
+              negative_ttl_(negative_ttl)
+        {
+            if (!threads)
+                threads = 1;
+            threads_.reserve(threads);
+            try {
+                for (unsigned i = 0; i < threads; ++i)
+                    threads_.emplace_back(&resolver::run, this);
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                cv_.notify_all();
+                for (auto &t : threads_)
+                    t.join();
+                throw;
+            }
+        }
+        resolver::~resolver()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            for (auto &t : threads_)
+                t.join();
+        }
+
+        int resolver::fd() const
+        {
+            return efd_.get();
+        }
+        size_t resolver::pending() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return pending_;
+        }
+        size_t resolver::cached() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return cache_.size();
+        }
+        size_t resolver::hits() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return hits_;
+        }
+        size_t resolver::misses() const
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return misses_;
+        }
+        void resolver::clear_cache()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cache_.clear();
+            lru_.clear();
+        }
+
+        void resolver::resolve(const std::string &host, const std::string &service,
+                callback cb, int family, int socktype, int flags)
+        {
+            std::string key(host);
+            key += '\0';
+            key += service;
+            key += '\0';
+            key += std::to_string(family) + ',' + std::to_string(socktype)
+                + ',' + std::to_string(flags);
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            ++pending_;
+            auto i = cache_.find(key);
+            if (i != cache_.end()) {
+                if (clock::now() < i->second.expires) {
+                    ++hits_;
+                    lru_.splice(lru_.begin(), lru_, i->second.pos);
+                    completion c = { std::move(cb), i->second.result };
+                    done_.push_back(std::move(c));
+                    lock.unlock();
+                    signal();
+                    return;
+                }
+                lru_.erase(i->second.pos);
+                cache_.erase(i);
+            }
+            ++misses_;
+            auto j = inflight_.find(key);
+            if (j != inflight_.end()) {
+                j->second.push_back(std::move(cb));
+                return;
+            }
+            inflight_[key].push_back(std::move(cb));
+            job x = { key, host, service, family, socktype, flags };
+            jobs_.push_back(std::move(x));
+            lock.unlock();
+            cv_.notify_one();
+        }
+
+        size_t resolver::process()
+        {
+            uint64_t v;
+            if (::read(efd_.get(), &v, sizeof v) == -1 && errno != EAGAIN)
+                throw read_error(errno);
+            std::vector<completion> cs;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cs.swap(done_);
+                pending_ -= cs.size();
+            }
+            for (auto &c : cs)
+                c.cb(*c.result);
+            return cs.size();
+        }
+
+        void resolver::signal()
+        {
+            uint64_t v = 1;
+            posix::write(efd_.get(), &v, sizeof v);
+        }
+
+        void resolver::run()
+        {
+            for (;;) {
+                job j;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this]{ return stop_ || !jobs_.empty(); });
+                    if (stop_)
+                        return;
+                    j = std::move(jobs_.front());
+                    jobs_.pop_front();
+                }
+                execute(j);
+            }
+        }
+
+        void resolver::execute(const job &j)
+        {
+            struct addrinfo hints;
+            memset(&hints, 0, sizeof hints);
+            hints.ai_family   = j.family;
+            hints.ai_socktype = j.socktype;
+            hints.ai_flags    = j.flags;
+            struct addrinfo *res = nullptr;
+            std::shared_ptr<resolve_result> r(new resolve_result());
+            r->error = ::getaddrinfo(j.host.empty() ? nullptr : j.host.c_str(),
+                    j.service.empty() ? nullptr : j.service.c_str(), &hints, &res);
+            if (r->error == EAI_SYSTEM && errno == EAGAIN)
+                r->error = EAI_AGAIN;
+            if (!r->error) {
+                for (struct addrinfo *a = res; a; a = a->ai_next) {
+                    endpoint e;
+                    memset(&e, 0, sizeof e);
+                    memcpy(&e.addr, a->ai_addr, a->ai_addrlen);
+                    e.addrlen  = a->ai_addrlen;
+                    e.family   = a->ai_family;
+                    e.socktype = a->ai_socktype;
+                    e.protocol = a->ai_protocol;
+                    r->endpoints.push_back(e);
+                }
+                freeaddrinfo(res);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                insert(j.key, r);
+                auto i = inflight_.find(j.key);
+                for (auto &cb : i->second) {
+                    completion c = { std::move(cb), r };
+                    done_.push_back(std::move(c));
+                }
+                inflight_.erase(i);
+            }
+            signal();
+        }
+
+        void resolver::insert(const std::string &key, const result_ptr &r)
+        {
+            std::chrono::milliseconds ttl;
+            switch (r->error) {
+                case 0:
+                    ttl = ttl_;
+                    break;
+                case EAI_NONAME:
+#ifdef EAI_NODATA
+                case EAI_NODATA:
+#endif
+                    ttl = negative_ttl_;
+                    break;
+                // e.g. EAI_AGAIN, i.e. transient errors aren't cached
+                default:
+                    return;
+            }
+            if (!max_entries_ || !ttl.count())
+                return;
+            auto i = cache_.find(key);
+            if (i != cache_.end()) {
+                lru_.erase(i->second.pos);
+                cache_.erase(i);
+            }
+            while (cache_.size() >= max_entries_) {
+                cache_.erase(lru_.back());
+                lru_.pop_back();
+            }
+            lru_.push_front(key);
+            entry e = { lru_.begin(), clock::now() + ttl, r };
+            cache_.emplace(key, std::move(e));
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,148 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_RESOLVER_HH
+#define IXXX_RESOLVER_HH
+
+#include <ixxx/fd.hh>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        struct endpoint {
+            struct sockaddr_storage addr;
+            socklen_t addrlen;
+            int family;
+            int socktype;
+            int protocol;
+        };
+
+        struct resolve_result {
+            // 0 or an EAI_* code as returned by getaddrinfo()
+            int error;
+            std::vector<endpoint> endpoints;
+
+            // cf. gai_strerror()
+            const char *what() const;
+        };
+
+        // Resolves host names without blocking the caller.
+        //
+        // Lookups are executed via getaddrinfo() on a small thread pool,
+        // completions are signalled via an eventfd (cf. fd()) such that
+        // the resolver integrates into an epoll loop. The callbacks are
+        // executed by process(), i.e. on the caller's thread.
+        //
+        // Results are cached (LRU bounded), failed lookups (EAI_NONAME,
+        // EAI_NODATA) are cached as well but for a shorter time. Since
+        // getaddrinfo() doesn't report record TTLs, the cache uses fixed
+        // TTLs. Concurrent lookups of the same key are coalesced.
+        class resolver {
+            public:
+                typedef std::function<void(const resolve_result &)> callback;
+
+                explicit resolver(unsigned threads = 2,
+                        size_t max_entries = 1024,
+                        std::chrono::milliseconds ttl = std::chrono::seconds(30),
+                        std::chrono::milliseconds negative_ttl
+                            = std::chrono::seconds(5));
+                // waits for running getaddrinfo() calls, callbacks of
+                // undelivered completions aren't called
+                ~resolver();
+                resolver(const resolver &) = delete;
+                resolver &operator=(const resolver &) = delete;
+
+                // the callback is called from process()
+                void resolve(const std::string &host, const std::string &service,
+                        callback cb, int family = AF_UNSPEC,
+                        int socktype = SOCK_STREAM, int flags = 0);
+
+                // eventfd that is readable when completions are pending
+                int fd() const;
+                // executes the callbacks of completed lookups,
+                // returns the number of callbacks called
+                size_t process();
+
+                // number of resolve() calls whose callbacks aren't
+                // processed, yet
+                size_t pending() const;
+                size_t cached() const;
+                size_t hits() const;
+                size_t misses() const;
+                void clear_cache();
+            private:
+                typedef std::shared_ptr<const resolve_result> result_ptr;
+                typedef std::chrono::steady_clock clock;
+                struct job {
+                    std::string key;
+                    std::string host;
+                    std::string service;
+                    int family;
+                    int socktype;
+                    int flags;
+                };
+                struct entry {
+                    std::list<std::string>::iterator pos;
+                    clock::time_point expires;
+                    result_ptr result;
+                };
+                struct completion {
+                    callback cb;
+                    result_ptr result;
+                };
+
+                void run();
+                void execute(const job &j);
+                // expects mutex_ to be held
+                void insert(const std::string &key, const result_ptr &r);
+                void signal();
+
+                unique_fd efd_;
+                size_t max_entries_;
+                std::chrono::milliseconds ttl_;
+                std::chrono::milliseconds negative_ttl_;
+
+                mutable std::mutex mutex_;
+                std::condition_variable cv_;
+                bool stop_ {false};
+                std::deque<job> jobs_;
+                std::unordered_map<std::string, std::vector<callback>> inflight_;
+                std::vector<completion> done_;
+                size_t pending_ {0};
+                size_t hits_ {0};
+                size_t misses_ {0};
+
+                // most recently used first
+                std::list<std::string> lru_;
+                std::unordered_map<std::string, entry> cache_;
+
+                std::vector<std::thread> threads_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_RESOLVER_HH
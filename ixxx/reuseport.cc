@@ -0,0 +1,185 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "reuseport.hh"
+
+#if defined(__linux__)
+
+#include "pthread.hh"
+#include "socket.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <string.h>
+#include <sched.h>
+#include <netinet/in.h>
+#include <linux/filter.h>
+
+#ifndef SO_ATTACH_REUSEPORT_CBPF
+#define SO_ATTACH_REUSEPORT_CBPF 51
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+        static uint16_t port_of(const struct sockaddr_storage &a)
+        {
+            if (a.ss_family == AF_INET)
+                return reinterpret_cast<const struct sockaddr_in&>(a).sin_port;
+            if (a.ss_family == AF_INET6)
+                return reinterpret_cast<const struct sockaddr_in6&>(a).sin6_port;
+            return 0;
+        }
+
+        reuseport_group::reuseport_group(const struct sockaddr *addr,
+                socklen_t len, unsigned n, int backlog)
+            : addr_(), addrlen_(len)
+        {
+            if (len > sizeof addr_)
+                throw bind_error(EINVAL);
+            memcpy(&addr_, addr, len);
+            fds_.reserve(n);
+            for (unsigned i = 0; i < n; ++i) {
+                unique_fd fd(posix::socket(addr->sa_family,
+                            SOCK_STREAM | SOCK_CLOEXEC, 0));
+                int one = 1;
+                posix::setsockopt(fd.get(), SOL_SOCKET, SO_REUSEPORT, &one, sizeof one);
+                posix::bind(fd.get(), reinterpret_cast<struct sockaddr*>(&addr_),
+                        addrlen_);
+                if (!i && !port_of(addr_)) {
+                    addrlen_ = sizeof addr_;
+                    posix::getsockname(fd.get(),
+                            reinterpret_cast<struct sockaddr*>(&addr_), &addrlen_);
+                }
+                posix::listen(fd.get(), backlog);
+                fds_.push_back(std::move(fd));
+            }
+        }
+
+        reuseport_group::~reuseport_group()
+        {
+            try {
+                join();
+            } catch (...) {
+            }
+        }
+
+        unsigned reuseport_group::size() const
+        {
+            return fds_.size();
+        }
+        int reuseport_group::listener(unsigned i) const
+        {
+            return fds_.at(i).get();
+        }
+        const struct sockaddr_storage &reuseport_group::addr() const
+        {
+            return addr_;
+        }
+        socklen_t reuseport_group::addrlen() const
+        {
+            return addrlen_;
+        }
+
+        void reuseport_group::steer_by_cpu(const std::vector<int> &cpus)
+        {
+            if (fds_.empty())
+                return;
+            std::vector<struct sock_filter> code;
+            // A = raw_smp_processor_id()
+            code.push_back(sock_filter(BPF_STMT(BPF_LD | BPF_W | BPF_ABS,
+                            uint32_t(SKF_AD_OFF + SKF_AD_CPU))));
+            // if (A == cpus[i]) return i;
+            for (unsigned i = 0; i < cpus.size() && i < fds_.size(); ++i) {
+                code.push_back(sock_filter(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+                                uint32_t(cpus[i]), 0, 1)));
+                code.push_back(sock_filter(BPF_STMT(BPF_RET | BPF_K, i)));
+            }
+            // return A % n;
+            code.push_back(sock_filter(BPF_STMT(BPF_ALU | BPF_MOD | BPF_K,
+                            uint32_t(fds_.size()))));
+            code.push_back(sock_filter(BPF_STMT(BPF_RET | BPF_A, 0)));
+            struct sock_fprog prog;
+            prog.len    = code.size();
+            prog.filter = code.data();
+            // the program applies to the whole group
+            posix::setsockopt(fds_.front().get(), SOL_SOCKET,
+                    SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof prog);
+        }
+
+        void *reuseport_group::worker_main(void *arg)
+        {
+            worker *w = static_cast<worker*>(arg);
+            reuseport_group *g = w->group;
+            try {
+                g->fn_(w->index, g->listener(w->index));
+            } catch (...) {
+                pthread_mutex_lock(&g->error_mutex_);
+                if (!g->error_)
+                    g->error_ = std::current_exception();
+                pthread_mutex_unlock(&g->error_mutex_);
+            }
+            return nullptr;
+        }
+
+        void reuseport_group::start_workers(worker_fn f, const std::vector<int> &cpus)
+        {
+            join();
+            for (unsigned i = 0; i < fds_.size(); ++i) {
+                int cpu = i < cpus.size() ? cpus[i] : int(i);
+                if (cpu < 0 || cpu >= CPU_SETSIZE)
+                    throw pthread_attr_setaffinity_np_error(EINVAL,
+                            "CPU out of range");
+            }
+            fn_ = f;
+            // no reallocation afterwards, the threads reference the elements
+            workers_.assign(fds_.size(), worker());
+            pthread_attr_t attr;
+            posix::pthread_attr_init(&attr);
+            try {
+                for (unsigned i = 0; i < fds_.size(); ++i) {
+                    cpu_set_t set;
+                    CPU_ZERO(&set);
+                    CPU_SET(i < cpus.size() ? cpus[i] : i, &set);
+                    posix::pthread_attr_setaffinity_np(&attr, sizeof set, &set);
+                    worker &w = workers_[i];
+                    w.group = this;
+                    w.index = i;
+                    posix::pthread_create(&w.thread, &attr, worker_main, &w);
+                    w.started = true;
+                }
+            } catch (...) {
+                pthread_attr_destroy(&attr);
+                // keep the original exception
+                try {
+                    join();
+                } catch (...) {
+                }
+                throw;
+            }
+            posix::pthread_attr_destroy(&attr);
+        }
+
+        void reuseport_group::join()
+        {
+            for (auto &w : workers_) {
+                if (w.started) {
+                    posix::pthread_join(w.thread, nullptr);
+                    w.started = false;
+                }
+            }
+            workers_.clear();
+            if (error_) {
+                std::exception_ptr e = error_;
+                error_ = nullptr;
+                std::rethrow_exception(e);
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
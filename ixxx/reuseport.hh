@@ -0,0 +1,94 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_REUSEPORT_HH
+#define IXXX_REUSEPORT_HH
+
+#include <ixxx/fd.hh>
+
+#include <exception>
+#include <functional>
+#include <vector>
+#include <pthread.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // One SO_REUSEPORT listener per worker, i.e. instead of all
+        // workers contending on the accept queue of a single listener
+        // the kernel distributes new connections over the group.
+        //
+        // With steer_by_cpu() the distribution is done by a classic BPF
+        // program (SO_ATTACH_REUSEPORT_CBPF) that selects the listener by
+        // the CPU that processed the incoming SYN. Thus, when worker i is
+        // pinned to cpus[i] (cf. start_workers()) and the NIC queues/RPS
+        // are set up accordingly, connections stay CPU-local end to end.
+        class reuseport_group {
+            public:
+                typedef std::function<void(unsigned index, int listen_fd)> worker_fn;
+
+                // Creates n listeners bound to addr. If addr has port 0
+                // all listeners are bound to the port the kernel picked
+                // for the first one.
+                reuseport_group(const struct sockaddr *addr, socklen_t len,
+                        unsigned n, int backlog = 1024);
+                // joins the workers (if any), i.e. worker functions have
+                // to return eventually (e.g. by checking a stop flag)
+                ~reuseport_group();
+                reuseport_group(const reuseport_group &) = delete;
+                reuseport_group &operator=(const reuseport_group &) = delete;
+
+                unsigned size() const;
+                int listener(unsigned i) const;
+                // the address all listeners are bound to
+                const struct sockaddr_storage &addr() const;
+                socklen_t addrlen() const;
+
+                // Steers connections received on CPU cpus[i] to listener i,
+                // connections on other CPUs to listener (cpu % size()).
+                // An empty cpus vector means CPU i -> listener i.
+                void steer_by_cpu(const std::vector<int> &cpus = std::vector<int>());
+
+                // Starts one thread per listener where thread i is pinned
+                // to cpus[i] (via pthread_attr_setaffinity_np()) and calls
+                // f(i, listener(i)). An empty cpus vector means thread i is
+                // pinned to CPU i. CPUs outside [0, CPU_SETSIZE) are
+                // rejected before any thread is started.
+                void start_workers(worker_fn f,
+                        const std::vector<int> &cpus = std::vector<int>());
+                // Joins all workers and rethrows the first exception
+                // a worker function threw (if any).
+                void join();
+            private:
+                struct worker {
+                    reuseport_group *group;
+                    unsigned index;
+                    pthread_t thread;
+                    bool started;
+                };
+                static void *worker_main(void *arg);
+
+                std::vector<unique_fd> fds_;
+                struct sockaddr_storage addr_;
+                socklen_t addrlen_;
+                worker_fn fn_;
+                std::vector<worker> workers_;
+                std::exception_ptr error_;
+                pthread_mutex_t error_mutex_ = PTHREAD_MUTEX_INITIALIZER;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_REUSEPORT_HH
@@ -0,0 +1,181 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_RING_HH
+#define IXXX_RING_HH
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        // Bounded lock-free multi-producer single-consumer queue.
+        //
+        // Each slot carries a sequence number that tells producers
+        // and the consumer whose turn it is (cf. Dmitry Vyukov's bounded
+        // MPMC queue), i.e. producers only contend on the head index.
+        //
+        // The capacity is rounded up to the next power of 2.
+        template <typename T>
+        class mpsc_ring {
+            public:
+                explicit mpsc_ring(size_t n)
+                {
+                    size_t k = 1;
+                    while (k < n)
+                        k *= 2;
+                    mask_ = k - 1;
+                    slots_.reset(new slot[k]);
+                    for (size_t i = 0; i < k; ++i)
+                        slots_[i].seq.store(i, std::memory_order_relaxed);
+                }
+                mpsc_ring(const mpsc_ring &) = delete;
+                mpsc_ring &operator=(const mpsc_ring &) = delete;
+
+                // returns false if the queue is full
+                bool try_push(const T &x)
+                {
+                    T y(x);
+                    return try_push(std::move(y));
+                }
+                bool try_push(T &&x)
+                {
+                    size_t pos = head_.load(std::memory_order_relaxed);
+                    for (;;) {
+                        slot &s = slots_[pos & mask_];
+                        size_t seq = s.seq.load(std::memory_order_acquire);
+                        intptr_t d = intptr_t(seq) - intptr_t(pos);
+                        if (!d) {
+                            if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+                                s.value = std::move(x);
+                                s.seq.store(pos + 1, std::memory_order_release);
+                                return true;
+                            }
+                        } else if (d < 0) {
+                            return false;
+                        } else {
+                            pos = head_.load(std::memory_order_relaxed);
+                        }
+                    }
+                }
+
+                // must only be called by the consumer
+                bool try_pop(T &x)
+                {
+                    slot &s = slots_[tail_ & mask_];
+                    size_t seq = s.seq.load(std::memory_order_acquire);
+                    if (seq != tail_ + 1)
+                        return false;
+                    x = std::move(s.value);
+                    s.seq.store(tail_ + mask_ + 1, std::memory_order_release);
+                    ++tail_;
+                    return true;
+                }
+                // must only be called by the consumer
+                bool empty() const
+                {
+                    const slot &s = slots_[tail_ & mask_];
+                    return s.seq.load(std::memory_order_acquire) != tail_ + 1;
+                }
+                size_t capacity() const { return mask_ + 1; }
+            private:
+                struct slot {
+                    std::atomic<size_t> seq;
+                    T value;
+                };
+                std::unique_ptr<slot[]> slots_;
+                size_t mask_;
+                // keep producer and consumer index on different cache lines
+                char pad0_[64];
+                std::atomic<size_t> head_ {0};
+                char pad1_[64];
+                size_t tail_ {0};
+        };
+
+        // Bounded lock-free single-producer single-consumer queue.
+        //
+        // Each side caches the index of the other side, i.e. it only
+        // reads the other side's cache line when the cached index says
+        // that the queue is full (or empty).
+        //
+        // The capacity is rounded up to the next power of 2.
+        template <typename T>
+        class spsc_ring {
+            public:
+                explicit spsc_ring(size_t n)
+                {
+                    size_t k = 1;
+                    while (k < n)
+                        k *= 2;
+                    mask_ = k - 1;
+                    slots_.reset(new T[k]);
+                }
+                spsc_ring(const spsc_ring &) = delete;
+                spsc_ring &operator=(const spsc_ring &) = delete;
+
+                // must only be called by the producer,
+                // returns false if the queue is full
+                bool try_push(const T &x)
+                {
+                    T y(x);
+                    return try_push(std::move(y));
+                }
+                bool try_push(T &&x)
+                {
+                    size_t h = head_.load(std::memory_order_relaxed);
+                    if (h - cached_tail_ > mask_) {
+                        cached_tail_ = tail_.load(std::memory_order_acquire);
+                        if (h - cached_tail_ > mask_)
+                            return false;
+                    }
+                    slots_[h & mask_] = std::move(x);
+                    head_.store(h + 1, std::memory_order_release);
+                    return true;
+                }
+
+                // must only be called by the consumer
+                bool try_pop(T &x)
+                {
+                    size_t t = tail_.load(std::memory_order_relaxed);
+                    if (t == cached_head_) {
+                        cached_head_ = head_.load(std::memory_order_acquire);
+                        if (t == cached_head_)
+                            return false;
+                    }
+                    x = std::move(slots_[t & mask_]);
+                    tail_.store(t + 1, std::memory_order_release);
+                    return true;
+                }
+                // must only be called by the consumer
+                bool empty() const
+                {
+                    return tail_.load(std::memory_order_relaxed)
+                        == head_.load(std::memory_order_acquire);
+                }
+                size_t capacity() const { return mask_ + 1; }
+            private:
+                std::unique_ptr<T[]> slots_;
+                size_t mask_;
+                char pad0_[64];
+                // producer side
+                std::atomic<size_t> head_ {0};
+                size_t cached_tail_ {0};
+                char pad1_[64];
+                // consumer side
+                std::atomic<size_t> tail_ {0};
+                size_t cached_head_ {0};
+                char pad2_[64];
+        };
+
+    }
+
+}
+
+#endif // IXXX_RING_HH
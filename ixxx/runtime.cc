@@ -0,0 +1,333 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "runtime.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "posix.hh"
+#include "pthread.hh"
+#include "sys_error.hh"
+
+#include <stdexcept>
+
+#include <errno.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        core::core(runtime &rt, unsigned index, int cpu)
+            : rt_(rt),
+              index_(index),
+              cpu_(cpu),
+              doorbell_(linux::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+        {
+        }
+
+        void core::setup()
+        {
+            size_t n = rt_.size();
+            size_t cap = rt_.cfg_.ring_capacity;
+            loop_.reset(new reactor());
+            inbox_.reserve(n);
+            for (size_t i = 0; i < n; ++i)
+                inbox_.emplace_back(new spsc_ring<task>(cap));
+            external_.reset(new mpsc_ring<task>(cap));
+            dirty_.reserve(n);
+            is_dirty_.assign(n, false);
+            loop_->add(doorbell_.get(), EPOLLIN, [](int fd, uint32_t) {
+                    uint64_t v;
+                    if (::read(fd, &v, sizeof v) == -1 && errno != EAGAIN)
+                        throw read_error(errno);
+                });
+        }
+
+        bool core::send(unsigned to, task t)
+        {
+            core &c = *rt_.cores_.at(to);
+            if (!c.inbox_[index_]->try_push(std::move(t)))
+                return false;
+            bump(sent_);
+            if (to != index_ && !is_dirty_[to]) {
+                is_dirty_[to] = true;
+                dirty_.push_back(to);
+            }
+            return true;
+        }
+
+        void core::ring()
+        {
+            // pairs with the fence in prepare_sleep()
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleeping_.load(std::memory_order_relaxed)
+                    && sleeping_.exchange(false, std::memory_order_relaxed)) {
+                uint64_t v = 1;
+                posix::write(doorbell_.get(), &v, sizeof v);
+            }
+        }
+
+        void core::flush()
+        {
+            if (dirty_.empty())
+                return;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            for (unsigned d : dirty_) {
+                core &c = *rt_.cores_[d];
+                if (c.sleeping_.load(std::memory_order_relaxed)
+                        && c.sleeping_.exchange(false,
+                            std::memory_order_relaxed)) {
+                    uint64_t v = 1;
+                    posix::write(c.doorbell_.get(), &v, sizeof v);
+                    bump(doorbells_);
+                }
+                is_dirty_[d] = false;
+            }
+            dirty_.clear();
+        }
+
+        size_t core::drain()
+        {
+            enum { batch = 64 };
+            size_t k = 0;
+            task t;
+            // bounded, i.e. a busy sender doesn't starve the others
+            // and the reactor
+            for (auto &r : inbox_) {
+                for (unsigned i = 0; i < batch && r->try_pop(t); ++i) {
+                    task u(std::move(t));
+                    u(*this);
+                    ++k;
+                }
+            }
+            for (unsigned i = 0; i < batch && external_->try_pop(t); ++i) {
+                task u(std::move(t));
+                u(*this);
+                ++k;
+            }
+            bump(tasks_, k);
+            return k;
+        }
+
+        bool core::prepare_sleep()
+        {
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            bool empty = !rt_.stopped() && external_->empty();
+            for (size_t i = 0; empty && i < inbox_.size(); ++i)
+                empty = inbox_[i]->empty();
+            if (!empty)
+                sleeping_.store(false, std::memory_order_relaxed);
+            return empty;
+        }
+
+        void core::run()
+        {
+            while (!rt_.stopped()) {
+                size_t n = drain();
+                flush();
+                int timeout = 0;
+                if (!n && prepare_sleep()) {
+                    timeout = -1;
+                    bump(sleeps_);
+                }
+                bump(events_, loop_->run_once(timeout));
+                sleeping_.store(false, std::memory_order_relaxed);
+            }
+        }
+
+        core::load_counters core::load() const
+        {
+            load_counters l;
+            l.tasks     = tasks_.load(std::memory_order_relaxed);
+            l.events    = events_.load(std::memory_order_relaxed);
+            l.sent      = sent_.load(std::memory_order_relaxed);
+            l.doorbells = doorbells_.load(std::memory_order_relaxed);
+            l.sleeps    = sleeps_.load(std::memory_order_relaxed);
+            return l;
+        }
+
+
+        runtime::runtime(const config &c)
+            : cfg_(c)
+        {
+            if (cfg_.cpus.empty()) {
+                cpu_set_t set;
+                linux::sched_getaffinity(0, sizeof set, &set);
+                for (int i = 0; i < CPU_SETSIZE; ++i) {
+                    if (CPU_ISSET(i, &set))
+                        cfg_.cpus.push_back(i);
+                }
+            }
+            for (int cpu : cfg_.cpus) {
+                if (cpu < 0 || cpu >= CPU_SETSIZE)
+                    throw pthread_attr_setaffinity_np_error(EINVAL,
+                            "CPU out of range");
+            }
+            cores_.reserve(cfg_.cpus.size());
+            for (unsigned i = 0; i < cfg_.cpus.size(); ++i)
+                cores_.emplace_back(new core(*this, i, cfg_.cpus[i]));
+        }
+
+        runtime::~runtime()
+        {
+            try {
+                shutdown();
+            } catch (...) {
+            }
+        }
+
+        void *runtime::core_main(void *arg)
+        {
+            core &c = *static_cast<core*>(arg);
+            runtime &rt = c.rt_;
+            bool ok = true;
+            try {
+                c.setup();
+            } catch (...) {
+                rt.fail(std::current_exception());
+                ok = false;
+            }
+            {
+                std::unique_lock<std::mutex> lock(rt.mutex_);
+                ++rt.ready_;
+                rt.cv_.notify_all();
+                rt.cv_.wait(lock, [&rt] {
+                        return rt.go_.load(std::memory_order_relaxed); });
+            }
+            // e.g. when another core failed or launch() was aborted
+            if (ok && !rt.stopped()) {
+                try {
+                    if (rt.init_)
+                        rt.init_(c);
+                } catch (...) {
+                    rt.fail(std::current_exception());
+                    ok = false;
+                }
+            }
+            {
+                std::lock_guard<std::mutex> lock(rt.mutex_);
+                ++rt.running_;
+            }
+            rt.cv_.notify_all();
+            if (!ok || rt.stopped())
+                return nullptr;
+            try {
+                c.run();
+            } catch (...) {
+                rt.fail(std::current_exception());
+            }
+            return nullptr;
+        }
+
+        void runtime::fail(std::exception_ptr e)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_)
+                    error_ = e;
+            }
+            stop_.store(true);
+            for (auto &c : cores_)
+                c->ring();
+        }
+
+        void runtime::launch(std::function<void(core &)> init)
+        {
+            if (launched_)
+                throw std::logic_error("runtime already launched");
+            launched_ = true;
+            init_ = std::move(init);
+            pthread_attr_t attr;
+            posix::pthread_attr_init(&attr);
+            try {
+                if (cfg_.policy != -1) {
+                    posix::pthread_attr_setinheritsched(&attr,
+                            PTHREAD_EXPLICIT_SCHED);
+                    posix::pthread_attr_setschedpolicy(&attr, cfg_.policy);
+                    struct sched_param p = sched_param();
+                    p.sched_priority = cfg_.priority;
+                    posix::pthread_attr_setschedparam(&attr, &p);
+                }
+                for (auto &c : cores_) {
+                    cpu_set_t set;
+                    CPU_ZERO(&set);
+                    CPU_SET(c->cpu_, &set);
+                    posix::pthread_attr_setaffinity_np(&attr, sizeof set, &set);
+                    posix::pthread_create(&c->thread_, &attr, core_main, c.get());
+                    c->started_ = true;
+                }
+            } catch (...) {
+                ::pthread_attr_destroy(&attr);
+                stop_.store(true);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    go_.store(true, std::memory_order_release);
+                }
+                cv_.notify_all();
+                try {
+                    shutdown();
+                } catch (...) {
+                }
+                throw;
+            }
+            posix::pthread_attr_destroy(&attr);
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return ready_ == cores_.size(); });
+                go_.store(true, std::memory_order_release);
+                cv_.notify_all();
+                // i.e. all init functions returned
+                cv_.wait(lock, [this] { return running_ == cores_.size(); });
+            }
+            if (stopped())
+                shutdown();
+        }
+
+        bool runtime::post(unsigned i, core::task t)
+        {
+            core &c = *cores_.at(i);
+            // pairs with the release store in launch(), i.e. the
+            // external_ rings that were allocated in setup() are visible
+            if (!go_.load(std::memory_order_acquire) || stopped()
+                    || !c.external_->try_push(std::move(t)))
+                return false;
+            c.ring();
+            return true;
+        }
+
+        void runtime::shutdown()
+        {
+            stop_.store(true);
+            for (auto &c : cores_)
+                c->ring();
+            for (auto &c : cores_) {
+                if (c->started_) {
+                    posix::pthread_join(c->thread_, nullptr);
+                    c->started_ = false;
+                }
+            }
+            std::exception_ptr e;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                std::swap(e, error_);
+            }
+            if (e)
+                std::rethrow_exception(e);
+        }
+
+        core::load_counters runtime::load(unsigned i) const
+        {
+            return cores_.at(i)->load();
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,201 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_RUNTIME_HH
+#define IXXX_RUNTIME_HH
+
+#include <ixxx/fd.hh>
+#include <ixxx/ring.hh>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <ixxx/reactor.hh>
+
+#include <pthread.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        class runtime;
+
+        // One pinned thread of a runtime with its own reactor.
+        class core {
+            public:
+                typedef std::function<void(core &)> task;
+                struct load_counters {
+                    // executed tasks
+                    uint64_t tasks;
+                    // dispatched reactor events (including doorbells)
+                    uint64_t events;
+                    // tasks sent to other cores
+                    uint64_t sent;
+                    // doorbells rung, i.e. eventfd writes
+                    uint64_t doorbells;
+                    // blocking waits
+                    uint64_t sleeps;
+                };
+
+                core(const core &) = delete;
+                core &operator=(const core &) = delete;
+
+                unsigned index() const { return index_; }
+                int cpu() const { return cpu_; }
+                runtime &owner() { return rt_; }
+                // must only be used from this core's thread
+                reactor &loop() { return *loop_; }
+
+                // Queues t for core `to` (which may be this core).
+                // Must only be called from this core's thread, returns
+                // false if the ring to that core is full. The doorbell
+                // of a sleeping core is rung once per loop iteration, i.e.
+                // for a batch of tasks.
+                bool send(unsigned to, task t);
+
+                // may be called from any thread
+                load_counters load() const;
+            private:
+                friend class runtime;
+
+                core(runtime &rt, unsigned index, int cpu);
+                // allocates the per-core state on the core's thread
+                void setup();
+                void run();
+                size_t drain();
+                void flush();
+                bool prepare_sleep();
+                // called from any thread
+                void ring();
+                static void bump(std::atomic<uint64_t> &a, uint64_t n = 1)
+                {
+                    a.store(a.load(std::memory_order_relaxed) + n,
+                            std::memory_order_relaxed);
+                }
+
+                runtime &rt_;
+                unsigned index_;
+                int cpu_;
+                unique_fd doorbell_;
+                std::unique_ptr<reactor> loop_;
+                // one ring per source core, indexed by its index
+                std::vector<std::unique_ptr<spsc_ring<task>>> inbox_;
+                // tasks posted from outside of the runtime
+                std::unique_ptr<mpsc_ring<task>> external_;
+                // destinations with unannounced tasks
+                std::vector<unsigned> dirty_;
+                std::vector<bool> is_dirty_;
+                pthread_t thread_;
+                bool started_ {false};
+                char pad0_[64];
+                std::atomic<bool> sleeping_ {false};
+                char pad1_[64];
+                std::atomic<uint64_t> tasks_ {0};
+                std::atomic<uint64_t> events_ {0};
+                std::atomic<uint64_t> sent_ {0};
+                std::atomic<uint64_t> doorbells_ {0};
+                std::atomic<uint64_t> sleeps_ {0};
+        };
+
+        // Shared-nothing thread-per-core runtime.
+        //
+        // Starts one thread per selected CPU (pinned via
+        // pthread_attr_setaffinity_np(), optionally with a real-time
+        // scheduling policy) where each thread runs its own reactor. A
+        // core's state (reactor, rings) is allocated by its own thread,
+        // thus it's placed on the local NUMA node (first touch). There is
+        // no explicit per-core allocator: a separate arena is only
+        // implicit via glibc's per-thread malloc arenas. Also, core::task
+        // is a std::function, i.e. constructing a task heap-allocates
+        // unless its captures fit into the small buffer (implementation
+        // defined, e.g. 16 bytes with libstdc++) - such a task is then
+        // allocated on the sending thread and freed on the receiving core.
+        //
+        // Cores communicate through one SPSC ring per pair of cores, i.e.
+        // without any locks or contended atomics. A core only writes to
+        // the eventfd doorbell of another core if that core announced
+        // that it's about to sleep.
+        //
+        // Memory usage is quadratic in the number of cores, i.e.
+        // size()^2 * ring_capacity task slots.
+        class runtime {
+            public:
+                struct config {
+                    // empty means all CPUs of the affinity mask,
+                    // the constructor throws on ids outside of CPU_SETSIZE
+                    std::vector<int> cpus;
+                    size_t ring_capacity {256};
+                    // e.g. SCHED_FIFO, -1 means inherit
+                    int policy {-1};
+                    int priority {0};
+                };
+
+                explicit runtime(const config &c);
+                // calls shutdown(), swallows exceptions
+                ~runtime();
+                runtime(const runtime &) = delete;
+                runtime &operator=(const runtime &) = delete;
+
+                unsigned size() const { return unsigned(cores_.size()); }
+                core &at(unsigned i) { return *cores_[i]; }
+
+                // Starts all cores and returns when they are running.
+                // init (if set) is called on each core's thread before
+                // its loop starts, e.g. to register descriptors. It may
+                // already send tasks to other cores.
+                void launch(std::function<void(core &)> init
+                        = std::function<void(core &)>());
+                // Queues t for core i from any thread (e.g. one outside of
+                // the runtime) after launch() returned, returns false if
+                // that queue is full or the runtime is stopped.
+                bool post(unsigned i, core::task t);
+                // Stops and joins all cores, rethrows the first exception
+                // a core threw (if any). Queued tasks are discarded.
+                void shutdown();
+                bool stopped() const
+                {
+                    return stop_.load(std::memory_order_relaxed);
+                }
+
+                core::load_counters load(unsigned i) const;
+            private:
+                friend class core;
+
+                static void *core_main(void *arg);
+                void fail(std::exception_ptr e);
+
+                config cfg_;
+                std::vector<std::unique_ptr<core>> cores_;
+                std::function<void(core &)> init_;
+                std::atomic<bool> stop_ {false};
+                bool launched_ {false};
+                std::mutex mutex_;
+                std::condition_variable cv_;
+                // number of cores that finished setup()
+                unsigned ready_ {0};
+                // written under mutex_, but also read by post() without it
+                std::atomic<bool> go_ {false};
+                // number of cores that finished init
+                unsigned running_ {0};
+                std::exception_ptr error_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_RUNTIME_HH
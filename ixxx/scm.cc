@@ -0,0 +1,320 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "scm.hh"
+
+#if defined(__linux__)
+
+#include "socket.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        namespace {
+
+            union control_buffer {
+                char buf[CMSG_SPACE(sizeof(int) * scm_max_fds)
+                    + CMSG_SPACE(sizeof(struct ucred))];
+                struct cmsghdr align;
+            };
+
+            void close_all(const int *fds, size_t n)
+            {
+                for (size_t i = 0; i < n; ++i)
+                    ::close(fds[i]);
+            }
+
+        }
+
+        void set_passcred(int fd, bool on)
+        {
+            int v = on;
+            posix::setsockopt(fd, SOL_SOCKET, SO_PASSCRED, &v, sizeof v);
+        }
+
+        size_t send_scm(int sock, const void *p, size_t n,
+                const int *fds, size_t nfds, bool creds, int flags)
+        {
+            if (nfds > scm_max_fds)
+                throw sendmsg_error(EINVAL, "too many file descriptors");
+            control_buffer control;
+            memset(&control, 0, sizeof control);
+            struct iovec iov = { const_cast<void*>(p), n };
+            struct msghdr h = msghdr();
+            h.msg_iov        = &iov;
+            h.msg_iovlen     = 1;
+            h.msg_control    = control.buf;
+            h.msg_controllen = (nfds ? CMSG_SPACE(sizeof(int) * nfds) : 0)
+                + (creds ? CMSG_SPACE(sizeof(struct ucred)) : 0);
+            struct cmsghdr *c = CMSG_FIRSTHDR(&h);
+            if (nfds) {
+                c->cmsg_level = SOL_SOCKET;
+                c->cmsg_type  = SCM_RIGHTS;
+                c->cmsg_len   = CMSG_LEN(sizeof(int) * nfds);
+                memcpy(CMSG_DATA(c), fds, sizeof(int) * nfds);
+                c = CMSG_NXTHDR(&h, c);
+            }
+            if (creds) {
+                struct ucred u;
+                u.pid = ::getpid();
+                u.uid = ::geteuid();
+                u.gid = ::getegid();
+                c->cmsg_level = SOL_SOCKET;
+                c->cmsg_type  = SCM_CREDENTIALS;
+                c->cmsg_len   = CMSG_LEN(sizeof u);
+                memcpy(CMSG_DATA(c), &u, sizeof u);
+            }
+            if (!h.msg_controllen)
+                h.msg_control = nullptr;
+            return posix::sendmsg(sock, &h, flags);
+        }
+
+        size_t recv_scm(int sock, void *p, size_t n, int *fds, size_t *nfds,
+                struct ucred *cred, int flags)
+        {
+            control_buffer control;
+            struct iovec iov = { p, n };
+            struct msghdr h = msghdr();
+            h.msg_iov        = &iov;
+            h.msg_iovlen     = 1;
+            h.msg_control    = control.buf;
+            h.msg_controllen = sizeof control.buf;
+            size_t r = posix::recvmsg(sock, &h, flags | MSG_CMSG_CLOEXEC);
+
+            size_t cap = nfds ? *nfds : 0;
+            size_t k = 0;
+            bool overflow = false;
+            if (cred)
+                *cred = ucred();
+            for (struct cmsghdr *c = CMSG_FIRSTHDR(&h); c; c = CMSG_NXTHDR(&h, c)) {
+                if (c->cmsg_level != SOL_SOCKET)
+                    continue;
+                if (c->cmsg_type == SCM_RIGHTS) {
+                    size_t m = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                    const unsigned char *d = CMSG_DATA(c);
+                    for (size_t i = 0; i < m; ++i) {
+                        int fd;
+                        memcpy(&fd, d + i * sizeof fd, sizeof fd);
+                        if (k < cap) {
+                            fds[k++] = fd;
+                        } else {
+                            ::close(fd);
+                            overflow = true;
+                        }
+                    }
+                } else if (c->cmsg_type == SCM_CREDENTIALS && cred) {
+                    memcpy(cred, CMSG_DATA(c), sizeof *cred);
+                }
+            }
+            if (overflow || h.msg_flags & MSG_CTRUNC) {
+                close_all(fds, k);
+                throw recvmsg_error(EMSGSIZE, "too many file descriptors");
+            }
+            if (nfds)
+                *nfds = k;
+            return r;
+        }
+
+
+        seqpacket_channel::slots::slots(size_t n, size_t msg_size,
+                size_t control_size)
+            : msgs(new struct mmsghdr[n]()),
+              iovs(new struct iovec[n]()),
+              bufs(new char[n * msg_size]),
+              controls(new char[n * control_size]())
+        {
+            for (size_t i = 0; i < n; ++i) {
+                iovs[i].iov_base = bufs.get() + i * msg_size;
+                iovs[i].iov_len  = msg_size;
+                msgs[i].msg_hdr.msg_iov    = &iovs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+        }
+
+        void seqpacket_channel::pair(unique_fd &a, unique_fd &b)
+        {
+            int sv[2];
+            posix::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sv);
+            a.reset(sv[0]);
+            b.reset(sv[1]);
+        }
+
+        seqpacket_channel::seqpacket_channel(int fd, size_t batch,
+                size_t msg_size, size_t max_fds)
+            : fd_(fd),
+              n_(batch),
+              msg_size_(msg_size),
+              max_fds_(std::min(max_fds, scm_max_fds)),
+              // CMSG_SPACE() is a multiple of the cmsghdr alignment,
+              // thus each slot is aligned
+              control_size_(CMSG_SPACE(sizeof(int) * max_fds_)),
+              out_(batch, msg_size, control_size_),
+              in_(batch, msg_size, control_size_),
+              nfds_(new size_t[batch]()),
+              rfds_(new int[batch * max_fds_])
+        {
+        }
+
+        seqpacket_channel::~seqpacket_channel()
+        {
+            close_received();
+        }
+
+        char *seqpacket_channel::control(const slots &s, size_t i) const
+        {
+            return s.controls.get() + i * control_size_;
+        }
+
+        bool seqpacket_channel::push(const void *p, size_t n,
+                const int *fds, size_t nfds)
+        {
+            if (count_ == n_)
+                return false;
+            if (n > msg_size_)
+                throw sendmmsg_error(EMSGSIZE);
+            if (nfds > max_fds_)
+                throw sendmmsg_error(EINVAL, "too many file descriptors");
+            memcpy(out_.bufs.get() + count_ * msg_size_, p, n);
+            out_.iovs[count_].iov_len = n;
+            struct msghdr &h = out_.msgs[count_].msg_hdr;
+            if (nfds) {
+                h.msg_control    = control(out_, count_);
+                h.msg_controllen = CMSG_SPACE(sizeof(int) * nfds);
+                struct cmsghdr *c = CMSG_FIRSTHDR(&h);
+                c->cmsg_level = SOL_SOCKET;
+                c->cmsg_type  = SCM_RIGHTS;
+                c->cmsg_len   = CMSG_LEN(sizeof(int) * nfds);
+                memcpy(CMSG_DATA(c), fds, sizeof(int) * nfds);
+            } else {
+                h.msg_control    = nullptr;
+                h.msg_controllen = 0;
+            }
+            ++count_;
+            return true;
+        }
+
+        size_t seqpacket_channel::flush(int flags)
+        {
+            size_t n = 0;
+            while (sent_ < count_) {
+                int r = ::sendmmsg(fd_.get(), out_.msgs.get() + sent_,
+                        count_ - sent_, flags);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return n;
+                    throw sendmmsg_error(errno);
+                }
+                sent_ += r;
+                n += r;
+            }
+            count_ = sent_ = 0;
+            return n;
+        }
+
+        size_t seqpacket_channel::recv(int flags)
+        {
+            close_received();
+            for (size_t i = 0; i < n_; ++i) {
+                in_.iovs[i].iov_len = msg_size_;
+                struct msghdr &h = in_.msgs[i].msg_hdr;
+                h.msg_control    = control(in_, i);
+                h.msg_controllen = control_size_;
+                h.msg_flags      = 0;
+            }
+            int r;
+            for (;;) {
+                r = ::recvmmsg(fd_.get(), in_.msgs.get(), n_,
+                        flags | MSG_CMSG_CLOEXEC | MSG_WAITFORONE, nullptr);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return 0;
+                    throw recvmmsg_error(errno);
+                }
+                break;
+            }
+            rcount_ = r;
+            for (size_t i = 0; i < rcount_; ++i) {
+                struct msghdr &h = in_.msgs[i].msg_hdr;
+                int *out = rfds_.get() + i * max_fds_;
+                size_t k = 0;
+                for (struct cmsghdr *c = CMSG_FIRSTHDR(&h); c;
+                        c = CMSG_NXTHDR(&h, c)) {
+                    if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS)
+                        continue;
+                    size_t m = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                    const unsigned char *d = CMSG_DATA(c);
+                    for (size_t j = 0; j < m; ++j) {
+                        int fd;
+                        memcpy(&fd, d + j * sizeof fd, sizeof fd);
+                        // can't happen as the control buffer
+                        // is sized for max_fds_
+                        if (k == max_fds_) {
+                            ::close(fd);
+                            continue;
+                        }
+                        out[k++] = fd;
+                    }
+                }
+                nfds_[i] = k;
+            }
+            return rcount_;
+        }
+
+        const char *seqpacket_channel::data(size_t i) const
+        {
+            return in_.bufs.get() + i * msg_size_;
+        }
+        size_t seqpacket_channel::length(size_t i) const
+        {
+            return in_.msgs[i].msg_len;
+        }
+        bool seqpacket_channel::truncated(size_t i) const
+        {
+            return in_.msgs[i].msg_hdr.msg_flags & (MSG_TRUNC | MSG_CTRUNC);
+        }
+        size_t seqpacket_channel::nfds(size_t i) const
+        {
+            return nfds_[i];
+        }
+        unique_fd seqpacket_channel::take_fd(size_t i, size_t j)
+        {
+            if (i >= rcount_ || j >= nfds_[i])
+                throw std::out_of_range("seqpacket_channel::take_fd");
+            int &fd = rfds_[i * max_fds_ + j];
+            unique_fd r(fd);
+            fd = -1;
+            return r;
+        }
+
+        void seqpacket_channel::close_received()
+        {
+            for (size_t i = 0; i < rcount_; ++i) {
+                const int *fds = rfds_.get() + i * max_fds_;
+                for (size_t j = 0; j < nfds_[i]; ++j) {
+                    if (fds[j] != -1)
+                        ::close(fds[j]);
+                }
+                nfds_[i] = 0;
+            }
+            rcount_ = 0;
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,140 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_SCM_HH
+#define IXXX_SCM_HH
+
+#include <ixxx/fd.hh>
+
+#include <memory>
+#include <stddef.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Helpers for passing file descriptors (SCM_RIGHTS) and
+        // credentials (SCM_CREDENTIALS) over Unix domain sockets.
+        //
+        // Control messages are built in stack buffers that are large
+        // enough for the kernel limit of SCM_MAX_FD (253) descriptors,
+        // i.e. nothing is allocated per call.
+
+        // maximum number of descriptors per message (cf. SCM_MAX_FD)
+        constexpr size_t scm_max_fds = 253;
+
+        // enables SO_PASSCRED, i.e. the kernel attaches the
+        // sender's credentials to received messages
+        void set_passcred(int fd, bool on = true);
+
+        // Sends n bytes along with the descriptors (the kernel duplicates
+        // them into the receiver, i.e. the caller can close them
+        // afterwards). With creds the caller's pid/uid/gid are attached.
+        // Returns the number of bytes sent.
+        size_t send_scm(int sock, const void *p, size_t n,
+                const int *fds, size_t nfds, bool creds = false, int flags = 0);
+
+        // Receives up to n bytes and up to *nfds descriptors (opened with
+        // O_CLOEXEC), *nfds is set to the number of received ones which
+        // are then owned by the caller. cred (if not null) is set to the
+        // sender's credentials, if those were attached (SO_PASSCRED),
+        // otherwise cred->pid is 0.
+        // Throws if more descriptors arrived than fit (all of them are
+        // closed then).
+        // Returns the number of bytes received.
+        size_t recv_scm(int sock, void *p, size_t n, int *fds, size_t *nfds,
+                struct ucred *cred = nullptr, int flags = 0);
+
+
+        // Batched message channel over a SOCK_SEQPACKET Unix domain socket,
+        // i.e. message boundaries are preserved, delivery is reliable and
+        // in order. Each message may carry descriptors, e.g. accepted
+        // connections or memfds that are handed off to another process.
+        //
+        // A whole batch is sent with one sendmmsg() and received with one
+        // recvmmsg() call. All message and control buffers are
+        // preallocated.
+        class seqpacket_channel {
+            public:
+                // Creates a connected pair, e.g. before fork().
+                static void pair(unique_fd &a, unique_fd &b);
+
+                // takes ownership of fd
+                explicit seqpacket_channel(int fd, size_t batch = 32,
+                        size_t msg_size = 256, size_t max_fds = 4);
+                ~seqpacket_channel();
+                seqpacket_channel(const seqpacket_channel &) = delete;
+                seqpacket_channel &operator=(const seqpacket_channel &) = delete;
+
+                int fd() const { return fd_.get(); }
+                size_t capacity() const { return n_; }
+
+                // Queues a message, returns false if the batch is full.
+                // The descriptors must stay open until the message is
+                // sent with flush().
+                bool push(const void *p, size_t n,
+                        const int *fds = nullptr, size_t nfds = 0);
+                // Sends the queued messages, returns the number of
+                // messages sent in this call. On a non-blocking socket
+                // some might remain pending, i.e. call flush() again later.
+                size_t flush(int flags = 0);
+                size_t pending() const { return count_ - sent_; }
+
+                // Receives up to capacity() messages, returns 0 if none are
+                // available on a non-blocking socket (or with MSG_DONTWAIT).
+                // Blocks for at most one message on a blocking socket.
+                //
+                // The received descriptors are owned by the caller, i.e.
+                // use take_fd() or close them. Descriptors not taken until
+                // the next recv() (or destruction) are closed then.
+                size_t recv(int flags = 0);
+                size_t size() const { return rcount_; }
+                const char *data(size_t i) const;
+                size_t length(size_t i) const;
+                // payload or descriptors didn't fit
+                bool truncated(size_t i) const;
+                size_t nfds(size_t i) const;
+                // transfers ownership of the j-th descriptor of message i
+                unique_fd take_fd(size_t i, size_t j);
+            private:
+                struct slots {
+                    slots(size_t n, size_t msg_size, size_t control_size);
+
+                    std::unique_ptr<struct mmsghdr[]> msgs;
+                    std::unique_ptr<struct iovec[]> iovs;
+                    std::unique_ptr<char[]> bufs;
+                    std::unique_ptr<char[]> controls;
+                };
+                char *control(const slots &s, size_t i) const;
+                void close_received();
+
+                unique_fd fd_;
+                size_t n_;
+                size_t msg_size_;
+                size_t max_fds_;
+                size_t control_size_;
+                slots out_;
+                slots in_;
+                size_t count_ {0};
+                size_t sent_ {0};
+                size_t rcount_ {0};
+                // per received message: number of descriptors and the
+                // descriptors (-1 when taken)
+                std::unique_ptr<size_t[]> nfds_;
+                std::unique_ptr<int[]> rfds_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_SCM_HH
@@ -0,0 +1,136 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "signal_dispatcher.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "pthread.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        signal_dispatcher::signal_dispatcher(const std::vector<int> &signals)
+            : handlers_(NSIG)
+        {
+            sigemptyset(&mask_);
+            for (int s : signals) {
+                if (sigaddset(&mask_, s) == -1)
+                    throw pthread_sigmask_error(errno);
+            }
+            posix::pthread_sigmask(SIG_BLOCK, &mask_, &old_mask_);
+            try {
+                sfd_.reset(linux::signalfd(-1, &mask_,
+                            SFD_NONBLOCK | SFD_CLOEXEC));
+            } catch (...) {
+                ::pthread_sigmask(SIG_SETMASK, &old_mask_, nullptr);
+                throw;
+            }
+        }
+
+        signal_dispatcher::~signal_dispatcher()
+        {
+            // close the signalfd first, i.e. signals that are still
+            // pending are delivered with their previous disposition
+            ::close(sfd_.release());
+            ::pthread_sigmask(SIG_SETMASK, &old_mask_, nullptr);
+        }
+
+        void signal_dispatcher::add(int signo)
+        {
+            int r = sigismember(&mask_, signo);
+            if (r == -1)
+                throw pthread_sigmask_error(errno);
+            if (r)
+                return;
+            sigset_t s;
+            sigemptyset(&s);
+            sigaddset(&s, signo);
+            posix::pthread_sigmask(SIG_BLOCK, &s, nullptr);
+            sigaddset(&mask_, signo);
+            linux::signalfd(sfd_.get(), &mask_, 0);
+        }
+
+        void signal_dispatcher::on(int signo, handler h)
+        {
+            add(signo);
+            handlers_[signo] = std::move(h);
+        }
+
+        void signal_dispatcher::on_child(child_handler h)
+        {
+            add(SIGCHLD);
+            child_ = std::move(h);
+        }
+
+        void signal_dispatcher::reap()
+        {
+            for (;;) {
+                siginfo_t si;
+                // waitid() doesn't touch si_pid when nothing is
+                // available, cf. waitid(2)
+                memset(&si, 0, sizeof si);
+                int r = ::waitid(P_ALL, 0, &si, WEXITED | WNOHANG);
+                if (r == -1) {
+                    if (errno == ECHILD)
+                        return;
+                    if (errno == EINTR)
+                        continue;
+                    throw waitid_error(errno);
+                }
+                if (!si.si_pid)
+                    return;
+                ++reaped_;
+                if (child_)
+                    child_(si);
+            }
+        }
+
+        size_t signal_dispatcher::process()
+        {
+            enum { batch = 16 };
+            struct signalfd_siginfo infos[batch];
+            size_t n = 0;
+            for (;;) {
+                ssize_t r = ::read(sfd_.get(), infos, sizeof infos);
+                if (r == -1) {
+                    if (errno == EAGAIN)
+                        break;
+                    if (errno == EINTR)
+                        continue;
+                    throw read_error(errno);
+                }
+                size_t k = size_t(r) / sizeof infos[0];
+                bool chld = false;
+                for (size_t i = 0; i < k; ++i) {
+                    uint32_t s = infos[i].ssi_signo;
+                    if (s == SIGCHLD)
+                        chld = true;
+                    if (s < handlers_.size() && handlers_[s])
+                        handlers_[s](infos[i]);
+                }
+                n += k;
+                // SIGCHLD might also be added with on(), reap in any
+                // case since the signalfd consumes the notification
+                if (chld)
+                    reap();
+                if (k < batch)
+                    break;
+            }
+            return n;
+        }
+
+    }
+
+}
+
+#endif // __linux__
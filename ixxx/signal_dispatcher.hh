@@ -0,0 +1,92 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_SIGNAL_DISPATCHER_HH
+#define IXXX_SIGNAL_DISPATCHER_HH
+
+#include <ixxx/fd.hh>
+
+#include <functional>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <signal.h>
+#include <sys/signalfd.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Synchronous signal handling via a signalfd, i.e. handlers run
+        // in the event loop (register fd() with EPOLLIN and call process()
+        // when it's readable) and may call anything, not just
+        // async-signal-safe functions.
+        //
+        // The signals are blocked with pthread_sigmask() in the calling
+        // thread only. The dispatcher MUST be constructed (and on() called
+        // for all additional signals) before any other thread is spawned,
+        // since only new threads inherit the mask - a thread that doesn't
+        // block a process-directed signal may receive it instead of the
+        // signalfd.
+        //
+        // Since SIGCHLD is a standard signal, multiple child exits may be
+        // coalesced into one. Thus, when SIGCHLD is part of the mask
+        // (via on_child() or on()) all terminated children are reaped
+        // with waitid(WNOHANG) after each batch that contains a SIGCHLD,
+        // instead of relying on the siginfo.
+        //
+        // The destructor restores the previous signal mask of the
+        // calling thread.
+        class signal_dispatcher {
+            public:
+                typedef std::function<void(const struct signalfd_siginfo &)>
+                    handler;
+                typedef std::function<void(const siginfo_t &)> child_handler;
+
+                explicit signal_dispatcher(const std::vector<int> &signals
+                        = std::vector<int>());
+                ~signal_dispatcher();
+                signal_dispatcher(const signal_dispatcher &) = delete;
+                signal_dispatcher &operator=(const signal_dispatcher &) = delete;
+
+                int fd() const { return sfd_.get(); }
+
+                // Blocks and adds the signal if necessary. A handler must
+                // not replace itself.
+                void on(int signo, handler h);
+                // Adds SIGCHLD, h is called for each reaped child.
+                // Note that this also reaps children other code might
+                // want to wait for.
+                void on_child(child_handler h);
+
+                // Reads all pending signals in batches and dispatches them,
+                // returns the number of read signals.
+                size_t process();
+
+                // number of children reaped by process()
+                uint64_t reaped() const { return reaped_; }
+            private:
+                void add(int signo);
+                void reap();
+
+                sigset_t mask_;
+                sigset_t old_mask_;
+                unique_fd sfd_;
+                std::vector<handler> handlers_;
+                child_handler child_;
+                uint64_t reaped_ {0};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_SIGNAL_DISPATCHER_HH
@@ -53,6 +53,13 @@ namespace ixxx {
             throw getaddrinfo_error(r, nullptr, sys_error::GAI);
     }
 
+    void getsockname(int sockfd, struct sockaddr *addr, socklen_t *addrlen)
+    {
+        int r = ::getsockname(sockfd, addr, addrlen);
+        if (r == -1)
+            throw getsockname_error(errno);
+    }
+
     int getsockopt(int fd, int level, int optname, void *val, socklen_t *len)
     {
         int r = ::getsockopt(fd, level, optname, val, len);
@@ -76,6 +83,46 @@ namespace ixxx {
         throw listen_error(errno);
       return r;
     }
+    ssize_t recv(int sockfd, void *buf, size_t len, int flags)
+    {
+#if defined(__MINGW32__) || defined(__MINGW64__)
+      ssize_t r = ::recv(sockfd, static_cast<char*>(buf), len, flags);
+#else
+      ssize_t r = ::recv(sockfd, buf, len, flags);
+#endif
+      if (r == -1)
+        throw recv_error(errno);
+      return r;
+    }
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    ssize_t recvmsg(int sockfd, struct msghdr *msg, int flags)
+    {
+      ssize_t r = ::recvmsg(sockfd, msg, flags);
+      if (r == -1)
+        throw recvmsg_error(errno);
+      return r;
+    }
+#endif
+    ssize_t send(int sockfd, const void *buf, size_t len, int flags)
+    {
+#if defined(__MINGW32__) || defined(__MINGW64__)
+      ssize_t r = ::send(sockfd, static_cast<const char*>(buf), len, flags);
+#else
+      ssize_t r = ::send(sockfd, buf, len, flags);
+#endif
+      if (r == -1)
+        throw send_error(errno);
+      return r;
+    }
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    ssize_t sendmsg(int sockfd, const struct msghdr *msg, int flags)
+    {
+      ssize_t r = ::sendmsg(sockfd, msg, flags);
+      if (r == -1)
+        throw sendmsg_error(errno);
+      return r;
+    }
+#endif
     int setsockopt(int sockfd, int level, int optname, const void *optval, socklen_t optlen)
     {
 #if defined(__MINGW32__) || defined(__MINGW64__)
@@ -102,6 +149,14 @@ namespace ixxx {
         throw socket_error(errno);
       return r;
     }
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    void socketpair(int domain, int type, int protocol, int sv[2])
+    {
+      int r = ::socketpair(domain, type, protocol, sv);
+      if (r == -1)
+        throw socketpair_error(errno);
+    }
+#endif
 
 
   } // posix
@@ -26,13 +26,25 @@ namespace ixxx {
     void getaddrinfo(const char *node, const char *service,
                      const struct addrinfo *hints,
                      struct addrinfo **res);
+    void getsockname(int sockfd, struct sockaddr *addr, socklen_t *addrlen);
     int getsockopt(int fd, int level, int optname, void *val, socklen_t *len);
     unsigned if_nametoindex(const char *ifname);
     int listen(int sockfd, int backlog);
+    ssize_t recv(int sockfd, void *buf, size_t len, int flags);
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    ssize_t recvmsg(int sockfd, struct msghdr *msg, int flags);
+#endif
+    ssize_t send(int sockfd, const void *buf, size_t len, int flags);
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    ssize_t sendmsg(int sockfd, const struct msghdr *msg, int flags);
+#endif
     int setsockopt(int sockfd, int level, int optname, const void *optval,
         socklen_t optlen);
     int shutdown(int socket, int how);
     int socket(int domain, int type, int protocol);
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+    void socketpair(int domain, int type, int protocol, int sv[2]);
+#endif
 
   }
 }
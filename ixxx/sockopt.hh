@@ -0,0 +1,207 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_SOCKOPT_HH
+#define IXXX_SOCKOPT_HH
+
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+
+#include <ixxx/socket.hh>
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <stdint.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/ip.h>
+#include <netinet/tcp.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        // Typed socket options, i.e. each option is a type that fixes
+        // level, name and value type at compile time:
+        //
+        //     sockopt::set<sockopt::tcp_nodelay>(fd, true);
+        //     int n = sockopt::get<sockopt::so_rcvbuf>(fd);
+        //
+        // Thus, passing an int where a struct linger is expected
+        // doesn't compile anymore.
+        namespace sockopt {
+
+            // Raw is what the kernel reads/writes, T is what the
+            // caller sees, e.g. bool options are passed as int.
+            template <int Level, int Name, typename T, typename Raw = T>
+            struct option {
+                enum { level = Level, name = Name };
+                typedef T value_type;
+
+                static T get(int fd)
+                {
+                    Raw r = Raw();
+                    socklen_t n = sizeof r;
+                    posix::getsockopt(fd, Level, Name, &r, &n);
+                    return T(r);
+                }
+                static void set(int fd, const T &v)
+                {
+                    Raw r(v);
+                    posix::setsockopt(fd, Level, Name, &r, sizeof r);
+                }
+            };
+
+            struct so_keepalive : option<SOL_SOCKET, SO_KEEPALIVE, bool, int> {};
+            struct so_linger    : option<SOL_SOCKET, SO_LINGER, struct linger> {};
+            // NB: on Linux, get() returns twice the value set, as the
+            // kernel accounts for bookkeeping overhead
+            struct so_rcvbuf    : option<SOL_SOCKET, SO_RCVBUF, int> {};
+            struct so_rcvtimeo  : option<SOL_SOCKET, SO_RCVTIMEO, struct timeval> {};
+            struct so_reuseaddr : option<SOL_SOCKET, SO_REUSEADDR, bool, int> {};
+            struct so_sndbuf    : option<SOL_SOCKET, SO_SNDBUF, int> {};
+            struct so_sndtimeo  : option<SOL_SOCKET, SO_SNDTIMEO, struct timeval> {};
+
+            struct ip_tos       : option<IPPROTO_IP, IP_TOS, int> {};
+            struct ip_ttl       : option<IPPROTO_IP, IP_TTL, int> {};
+
+            struct tcp_nodelay  : option<IPPROTO_TCP, TCP_NODELAY, bool, int> {};
+
+#if defined(__linux__)
+            // busy poll timeout in microseconds
+            struct so_busy_poll     : option<SOL_SOCKET, SO_BUSY_POLL, int> {};
+            struct so_incoming_cpu  : option<SOL_SOCKET, SO_INCOMING_CPU, int> {};
+            struct so_reuseport     : option<SOL_SOCKET, SO_REUSEPORT, bool, int> {};
+
+            struct tcp_keepcnt      : option<IPPROTO_TCP, TCP_KEEPCNT, int> {};
+            struct tcp_keepidle     : option<IPPROTO_TCP, TCP_KEEPIDLE, int> {};
+            struct tcp_keepintvl    : option<IPPROTO_TCP, TCP_KEEPINTVL, int> {};
+            struct tcp_quickack     : option<IPPROTO_TCP, TCP_QUICKACK, bool, int> {};
+            // in milliseconds
+            struct tcp_user_timeout : option<IPPROTO_TCP, TCP_USER_TIMEOUT, unsigned> {};
+
+            // congestion control algorithm name, e.g. "cubic" or "bbr"
+            struct tcp_congestion {
+                enum { level = IPPROTO_TCP, name = TCP_CONGESTION };
+                typedef std::string value_type;
+
+                static std::string get(int fd)
+                {
+                    // cf. TCP_CA_NAME_MAX
+                    char buf[16] = { 0 };
+                    socklen_t n = sizeof buf;
+                    posix::getsockopt(fd, level, name, buf, &n);
+                    return std::string(buf, strnlen(buf, n));
+                }
+                static void set(int fd, const std::string &v)
+                {
+                    posix::setsockopt(fd, level, name, v.data(), v.size());
+                }
+            };
+#endif
+
+            template <typename O>
+            inline typename O::value_type get(int fd)
+            {
+                return O::get(fd);
+            }
+            template <typename O>
+            inline void set(int fd, const typename O::value_type &v)
+            {
+                O::set(fd, v);
+            }
+
+
+            namespace detail {
+
+                template <typename O, typename... Opts>
+                struct index_of;
+                template <typename O, typename... Opts>
+                struct index_of<O, O, Opts...>
+                    : std::integral_constant<size_t, 0> {};
+                template <typename O, typename P, typename... Opts>
+                struct index_of<O, P, Opts...>
+                    : std::integral_constant<size_t,
+                        1 + index_of<O, Opts...>::value> {};
+
+            }
+
+            // A set of options that is applied to many sockets, e.g. to
+            // each accepted connection. Only the options that were
+            // actually set() are applied, i.e. one setsockopt() call per
+            // set option and none for the rest.
+            //
+            //     sockopt::bundle<sockopt::tcp_nodelay, sockopt::so_rcvbuf> b;
+            //     b.set<sockopt::tcp_nodelay>(true);
+            //     b.apply(fd);
+            //
+            // NB: on Linux, accepted sockets inherit most options
+            // (e.g. buffer sizes, TCP_NODELAY) from the listener, thus
+            // setting those once on the listener is even cheaper.
+            template <typename... Opts>
+            class bundle {
+                public:
+                    static_assert(sizeof...(Opts) <= 32, "too many options");
+
+                    template <typename O>
+                    bundle &set(const typename O::value_type &v)
+                    {
+                        std::get<index<O>::value>(values_) = v;
+                        mask_ |= uint32_t(1) << index<O>::value;
+                        return *this;
+                    }
+                    template <typename O>
+                    bundle &reset()
+                    {
+                        mask_ &= ~(uint32_t(1) << index<O>::value);
+                        return *this;
+                    }
+                    template <typename O>
+                    bool is_set() const
+                    {
+                        return mask_ & (uint32_t(1) << index<O>::value);
+                    }
+                    template <typename O>
+                    const typename O::value_type &value() const
+                    {
+                        return std::get<index<O>::value>(values_);
+                    }
+                    bool empty() const { return !mask_; }
+
+                    void apply(int fd) const
+                    {
+                        if (mask_)
+                            apply_<0, Opts...>(fd);
+                    }
+                private:
+                    template <typename O>
+                    struct index : detail::index_of<O, Opts...> {};
+
+                    template <size_t I>
+                    void apply_(int) const
+                    {
+                    }
+                    template <size_t I, typename O, typename... Rest>
+                    void apply_(int fd) const
+                    {
+                        if (mask_ & (uint32_t(1) << I))
+                            O::set(fd, std::get<I>(values_));
+                        apply_<I + 1, Rest...>(fd);
+                    }
+
+                    std::tuple<typename Opts::value_type...> values_;
+                    uint32_t mask_ {0};
+            };
+
+        }
+
+    }
+
+}
+
+#endif // !__MINGW32__
+
+#endif // IXXX_SOCKOPT_HH
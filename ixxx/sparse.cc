@@ -0,0 +1,282 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "sparse.hh"
+
+#if defined(__linux__)
+
+#include "posix.hh"
+#include "linux.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <linux/fs.h>
+#include <linux/fiemap.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        // extents per FIEMAP ioctl
+        static const unsigned fiemap_batch = 128;
+
+        extent_reader::extent_reader(int fd, Method m)
+            : fd_(fd), method_(m)
+        {
+            struct stat st;
+            posix::fstat(fd, &st);
+            size_ = st.st_size;
+            if (method_ == AUTO || method_ == FIEMAP) {
+                buf_.resize(sizeof(struct fiemap)
+                        + fiemap_batch * sizeof(struct fiemap_extent));
+                try {
+                    fill_fiemap();
+                    method_ = FIEMAP;
+                } catch (const ioctl_error &e) {
+                    if (method_ == FIEMAP)
+                        throw;
+                    switch (e.code()) {
+                        case ENOTTY:
+                        case EOPNOTSUPP:
+                        case EINVAL:
+                            method_ = SEEK;
+                            break;
+                        default:
+                            throw;
+                    }
+                }
+            }
+        }
+
+        extent_reader::Method extent_reader::method() const
+        {
+            return method_;
+        }
+        off_t extent_reader::size() const
+        {
+            return size_;
+        }
+
+        bool extent_reader::next(extent &e)
+        {
+            if (!have_pending_) {
+                if (!next_raw(pending_))
+                    return false;
+                have_pending_ = true;
+            }
+            e = pending_;
+            have_pending_ = false;
+            extent x;
+            while (next_raw(x)) {
+                if (x.offset == e.offset + e.length) {
+                    e.length += x.length;
+                } else {
+                    pending_ = x;
+                    have_pending_ = true;
+                    break;
+                }
+            }
+            return true;
+        }
+
+        bool extent_reader::next_raw(extent &e)
+        {
+            if (method_ == FIEMAP)
+                return next_fiemap(e);
+            else
+                return next_seek(e);
+        }
+
+        bool extent_reader::fill_fiemap()
+        {
+            struct fiemap *fm = reinterpret_cast<struct fiemap*>(buf_.data());
+            *fm = fiemap();
+            fm->fm_start        = pos_;
+            fm->fm_length       = FIEMAP_MAX_OFFSET - pos_;
+            fm->fm_extent_count = fiemap_batch;
+            posix::ioctl(fd_, FS_IOC_FIEMAP, fm);
+            idx_ = 0;
+            n_   = fm->fm_mapped_extents;
+            lo_  = pos_;
+            if (!n_)
+                eof_ = true;
+            return n_;
+        }
+
+        bool extent_reader::next_fiemap(extent &e)
+        {
+            const struct fiemap *fm =
+                reinterpret_cast<const struct fiemap*>(buf_.data());
+            for (;;) {
+                if (idx_ == n_) {
+                    if (eof_ || !fill_fiemap())
+                        return false;
+                }
+                const struct fiemap_extent &x = fm->fm_extents[idx_++];
+                off_t end = std::min(off_t(x.fe_logical + x.fe_length), size_);
+                pos_ = x.fe_logical + x.fe_length;
+                if (x.fe_flags & FIEMAP_EXTENT_LAST || pos_ >= size_) {
+                    eof_ = true;
+                    n_ = idx_;
+                }
+                // unwritten extents read as zeroes
+                if (x.fe_flags & FIEMAP_EXTENT_UNWRITTEN)
+                    continue;
+                // the first extent of a batch may overlap the previous one
+                off_t begin = std::max(off_t(x.fe_logical), lo_);
+                if (begin >= end)
+                    continue;
+                e.offset = begin;
+                e.length = end - e.offset;
+                return true;
+            }
+        }
+
+        bool extent_reader::next_seek(extent &e)
+        {
+            if (eof_ || pos_ >= size_)
+                return false;
+            off_t data = ::lseek(fd_, pos_, SEEK_DATA);
+            if (data == -1) {
+                if (errno == ENXIO) {
+                    eof_ = true;
+                    return false;
+                }
+                throw lseek_error(errno);
+            }
+            off_t hole = posix::lseek(fd_, data, SEEK_HOLE);
+            hole = std::min(hole, size_);
+            pos_ = hole;
+            if (data >= hole)
+                return false;
+            e.offset = data;
+            e.length = hole - data;
+            return true;
+        }
+
+
+        namespace {
+
+            class range_copier {
+                public:
+                    range_copier(int src, int dst) : src_(src), dst_(dst) {}
+                    void copy(off_t off, off_t len);
+                private:
+                    void copy_rw(off_t off, off_t len);
+
+                    int src_;
+                    int dst_;
+                    bool use_cfr_ {true};
+                    std::vector<char> buf_;
+            };
+
+            void range_copier::copy(off_t off, off_t len)
+            {
+                while (use_cfr_ && len) {
+                    off_t in_off = off, out_off = off;
+                    ssize_t r = ::copy_file_range(src_, &in_off, dst_, &out_off,
+                            len, 0);
+                    if (r == -1) {
+                        switch (errno) {
+                            case EINTR:
+                                continue;
+                            // e.g. kernel too old or cross filesystem
+                            // copy on kernels < 5.3
+                            case ENOSYS:
+                            case EXDEV:
+                            case EOPNOTSUPP:
+                            case EINVAL:
+                                use_cfr_ = false;
+                                break;
+                            default:
+                                throw copy_file_range_error(errno);
+                        }
+                        break;
+                    }
+                    if (!r)
+                        throw copy_file_range_error(0,
+                                "unexpected end of source file");
+                    off += r;
+                    len -= r;
+                }
+                if (len)
+                    copy_rw(off, len);
+            }
+
+            void range_copier::copy_rw(off_t off, off_t len)
+            {
+                if (buf_.empty())
+                    buf_.resize(128 * 1024);
+                while (len) {
+                    size_t n = std::min(off_t(buf_.size()), len);
+                    ssize_t r = posix::pread(src_, buf_.data(), n, off);
+                    if (!r)
+                        throw pread_error(0, "unexpected end of source file");
+                    for (ssize_t i = 0; i < r; ) {
+                        i += posix::pwrite(dst_, buf_.data() + i, r - i, off + i);
+                    }
+                    off += r;
+                    len -= r;
+                }
+            }
+
+            void punch_hole(int fd, off_t off, off_t len)
+            {
+                if (len <= 0)
+                    return;
+                try {
+                    linux::fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                            off, len);
+                } catch (const fallocate_error &e) {
+                    if (e.code() != EOPNOTSUPP)
+                        throw;
+                    // filesystem doesn't support holes, thus
+                    // we have to zero the range the hard way
+                    std::vector<char> zeroes(std::min(len, off_t(128 * 1024)));
+                    while (len) {
+                        size_t n = std::min(off_t(zeroes.size()), len);
+                        ssize_t r = posix::pwrite(fd, zeroes.data(), n, off);
+                        off += r;
+                        len -= r;
+                    }
+                }
+            }
+
+        }
+
+        off_t sparse_copy(int src, int dst)
+        {
+            extent_reader reader(src);
+            struct stat st;
+            posix::fstat(dst, &st);
+            // beyond the old size everything is a hole after the truncate
+            off_t old_dst_size = std::min(st.st_size, reader.size());
+            posix::ftruncate(dst, reader.size());
+
+            range_copier copier(src, dst);
+            off_t copied = 0;
+            off_t pos = 0;
+            extent e;
+            while (reader.next(e)) {
+                if (pos < old_dst_size)
+                    punch_hole(dst, pos, std::min(e.offset, old_dst_size) - pos);
+                copier.copy(e.offset, e.length);
+                copied += e.length;
+                pos = e.offset + e.length;
+            }
+            if (pos < old_dst_size)
+                punch_hole(dst, pos, old_dst_size - pos);
+            return copied;
+        }
+
+    }
+
+}
+
+#endif // __linux__
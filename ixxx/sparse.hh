@@ -0,0 +1,73 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_SPARSE_HH
+#define IXXX_SPARSE_HH
+
+#include <sys/types.h>
+#include <vector>
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        struct extent {
+            off_t offset;
+            off_t length;
+        };
+
+        // Iterates over the data extents of a (possibly sparse) file,
+        // i.e. holes and unwritten (preallocated) ranges are skipped.
+        //
+        // FIEMAP is used where the filesystem supports it, otherwise
+        // it falls back to lseek(SEEK_DATA/SEEK_HOLE).
+        // Adjacent extents are merged.
+        class extent_reader {
+            public:
+                enum Method { AUTO, FIEMAP, SEEK };
+
+                explicit extent_reader(int fd, Method m = AUTO);
+
+                // returns false when there are no further data extents
+                bool next(extent &e);
+
+                Method method() const;
+                off_t size() const;
+            private:
+                bool next_raw(extent &e);
+                bool next_fiemap(extent &e);
+                bool next_seek(extent &e);
+                bool fill_fiemap();
+
+                int fd_;
+                Method method_;
+                off_t size_ {0};
+                off_t pos_ {0};
+                off_t lo_ {0};
+                bool eof_ {false};
+                bool have_pending_ {false};
+                extent pending_ {0, 0};
+
+                std::vector<unsigned char> buf_;
+                unsigned idx_ {0};
+                unsigned n_ {0};
+        };
+
+        // Copies the content of src to dst such that only data extents
+        // are transferred (via copy_file_range() or pread()/pwrite() as
+        // fallback). Holes in src end up as holes in dst, i.e. existing
+        // data in dst is punched out where src has holes.
+        //
+        // Returns the number of data bytes copied.
+        off_t sparse_copy(int src, int dst);
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_SPARSE_HH
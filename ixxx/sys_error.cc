@@ -101,6 +101,8 @@ namespace ixxx {
     // Autogenerated by mk_boilerplate.py - begin
     Function accept_error::function() const { return Function::ACCEPT; }
     const char* accept_error::name() const { return "accept"; }
+    Function accept4_error::function() const { return Function::ACCEPT4; }
+    const char* accept4_error::name() const { return "accept4"; }
     Function bind_error::function() const { return Function::BIND; }
     const char* bind_error::name() const { return "bind"; }
     Function calloc_error::function() const { return Function::CALLOC; }
@@ -109,10 +111,14 @@ namespace ixxx {
     const char* clock_gettime_error::name() const { return "clock_gettime"; }
     Function close_error::function() const { return Function::CLOSE; }
     const char* close_error::name() const { return "close"; }
+    Function close_range_error::function() const { return Function::CLOSE_RANGE; }
+    const char* close_range_error::name() const { return "close_range"; }
     Function closedir_error::function() const { return Function::CLOSEDIR; }
     const char* closedir_error::name() const { return "closedir"; }
     Function connect_error::function() const { return Function::CONNECT; }
     const char* connect_error::name() const { return "connect"; }
+    Function copy_file_range_error::function() const { return Function::COPY_FILE_RANGE; }
+    const char* copy_file_range_error::name() const { return "copy_file_range"; }
     Function dup_error::function() const { return Function::DUP; }
     const char* dup_error::name() const { return "dup"; }
     Function dup2_error::function() const { return Function::DUP2; }
@@ -121,6 +127,10 @@ namespace ixxx {
     const char* epoll_create1_error::name() const { return "epoll_create1"; }
     Function epoll_ctl_error::function() const { return Function::EPOLL_CTL; }
     const char* epoll_ctl_error::name() const { return "epoll_ctl"; }
+    Function epoll_pwait_error::function() const { return Function::EPOLL_PWAIT; }
+    const char* epoll_pwait_error::name() const { return "epoll_pwait"; }
+    Function epoll_pwait2_error::function() const { return Function::EPOLL_PWAIT2; }
+    const char* epoll_pwait2_error::name() const { return "epoll_pwait2"; }
     Function epoll_wait_error::function() const { return Function::EPOLL_WAIT; }
     const char* epoll_wait_error::name() const { return "epoll_wait"; }
     Function execv_error::function() const { return Function::EXECV; }
@@ -131,6 +141,12 @@ namespace ixxx {
     const char* execvpe_error::name() const { return "execvpe"; }
     Function eventfd_error::function() const { return Function::EVENTFD; }
     const char* eventfd_error::name() const { return "eventfd"; }
+    Function fallocate_error::function() const { return Function::FALLOCATE; }
+    const char* fallocate_error::name() const { return "fallocate"; }
+    Function fanotify_init_error::function() const { return Function::FANOTIFY_INIT; }
+    const char* fanotify_init_error::name() const { return "fanotify_init"; }
+    Function fanotify_mark_error::function() const { return Function::FANOTIFY_MARK; }
+    const char* fanotify_mark_error::name() const { return "fanotify_mark"; }
     Function fclose_error::function() const { return Function::FCLOSE; }
     const char* fclose_error::name() const { return "fclose"; }
     Function fcntl_error::function() const { return Function::FCNTL; }
@@ -169,12 +185,20 @@ namespace ixxx {
     const char* getpwnam_r_error::name() const { return "getpwnam_r"; }
     Function getpwuid_r_error::function() const { return Function::GETPWUID_R; }
     const char* getpwuid_r_error::name() const { return "getpwuid_r"; }
+    Function getsockname_error::function() const { return Function::GETSOCKNAME; }
+    const char* getsockname_error::name() const { return "getsockname"; }
     Function getsockopt_error::function() const { return Function::GETSOCKOPT; }
     const char* getsockopt_error::name() const { return "getsockopt"; }
     Function gmtime_r_error::function() const { return Function::GMTIME_R; }
     const char* gmtime_r_error::name() const { return "gmtime_r"; }
     Function if_nametoindex_error::function() const { return Function::IF_NAMETOINDEX; }
     const char* if_nametoindex_error::name() const { return "if_nametoindex"; }
+    Function inotify_add_watch_error::function() const { return Function::INOTIFY_ADD_WATCH; }
+    const char* inotify_add_watch_error::name() const { return "inotify_add_watch"; }
+    Function inotify_init1_error::function() const { return Function::INOTIFY_INIT1; }
+    const char* inotify_init1_error::name() const { return "inotify_init1"; }
+    Function inotify_rm_watch_error::function() const { return Function::INOTIFY_RM_WATCH; }
+    const char* inotify_rm_watch_error::name() const { return "inotify_rm_watch"; }
     Function io_destroy_error::function() const { return Function::IO_DESTROY; }
     const char* io_destroy_error::name() const { return "io_destroy"; }
     Function io_getevents_error::function() const { return Function::IO_GETEVENTS; }
@@ -183,6 +207,8 @@ namespace ixxx {
     const char* io_setup_error::name() const { return "io_setup"; }
     Function io_submit_error::function() const { return Function::IO_SUBMIT; }
     const char* io_submit_error::name() const { return "io_submit"; }
+    Function ioctl_error::function() const { return Function::IOCTL; }
+    const char* ioctl_error::name() const { return "ioctl"; }
     Function isatty_error::function() const { return Function::ISATTY; }
     const char* isatty_error::name() const { return "isatty"; }
     Function link_error::function() const { return Function::LINK; }
@@ -209,6 +235,8 @@ namespace ixxx {
     const char* mkstemp_error::name() const { return "mkstemp"; }
     Function mmap_error::function() const { return Function::MMAP; }
     const char* mmap_error::name() const { return "mmap"; }
+    Function mprotect_error::function() const { return Function::MPROTECT; }
+    const char* mprotect_error::name() const { return "mprotect"; }
     Function msync_error::function() const { return Function::MSYNC; }
     const char* msync_error::name() const { return "msync"; }
     Function munmap_error::function() const { return Function::MUNMAP; }
@@ -219,6 +247,8 @@ namespace ixxx {
     const char* open_error::name() const { return "open"; }
     Function openat_error::function() const { return Function::OPENAT; }
     const char* openat_error::name() const { return "openat"; }
+    Function openat2_error::function() const { return Function::OPENAT2; }
+    const char* openat2_error::name() const { return "openat2"; }
     Function opendir_error::function() const { return Function::OPENDIR; }
     const char* opendir_error::name() const { return "opendir"; }
     Function pipe_error::function() const { return Function::PIPE; }
@@ -227,10 +257,16 @@ namespace ixxx {
     const char* poll_error::name() const { return "poll"; }
     Function pread_error::function() const { return Function::PREAD; }
     const char* pread_error::name() const { return "pread"; }
+    Function pthread_setname_np_error::function() const { return Function::PTHREAD_SETNAME_NP; }
+    const char* pthread_setname_np_error::name() const { return "pthread_setname_np"; }
+    Function pthread_sigmask_error::function() const { return Function::PTHREAD_SIGMASK; }
+    const char* pthread_sigmask_error::name() const { return "pthread_sigmask"; }
     Function pwrite_error::function() const { return Function::PWRITE; }
     const char* pwrite_error::name() const { return "pwrite"; }
     Function posix_fallocate_error::function() const { return Function::POSIX_FALLOCATE; }
     const char* posix_fallocate_error::name() const { return "posix_fallocate"; }
+    Function ppoll_error::function() const { return Function::PPOLL; }
+    const char* ppoll_error::name() const { return "ppoll"; }
     Function prctl_error::function() const { return Function::PRCTL; }
     const char* prctl_error::name() const { return "prctl"; }
     Function pthread_attr_destroy_error::function() const { return Function::PTHREAD_ATTR_DESTROY; }
@@ -239,12 +275,18 @@ namespace ixxx {
     const char* pthread_attr_init_error::name() const { return "pthread_attr_init"; }
     Function pthread_attr_setaffinity_np_error::function() const { return Function::PTHREAD_ATTR_SETAFFINITY_NP; }
     const char* pthread_attr_setaffinity_np_error::name() const { return "pthread_attr_setaffinity_np"; }
+    Function pthread_attr_setguardsize_error::function() const { return Function::PTHREAD_ATTR_SETGUARDSIZE; }
+    const char* pthread_attr_setguardsize_error::name() const { return "pthread_attr_setguardsize"; }
     Function pthread_attr_setinheritsched_error::function() const { return Function::PTHREAD_ATTR_SETINHERITSCHED; }
     const char* pthread_attr_setinheritsched_error::name() const { return "pthread_attr_setinheritsched"; }
     Function pthread_attr_setschedparam_error::function() const { return Function::PTHREAD_ATTR_SETSCHEDPARAM; }
     const char* pthread_attr_setschedparam_error::name() const { return "pthread_attr_setschedparam"; }
     Function pthread_attr_setschedpolicy_error::function() const { return Function::PTHREAD_ATTR_SETSCHEDPOLICY; }
     const char* pthread_attr_setschedpolicy_error::name() const { return "pthread_attr_setschedpolicy"; }
+    Function pthread_attr_setstack_error::function() const { return Function::PTHREAD_ATTR_SETSTACK; }
+    const char* pthread_attr_setstack_error::name() const { return "pthread_attr_setstack"; }
+    Function pthread_attr_setstacksize_error::function() const { return Function::PTHREAD_ATTR_SETSTACKSIZE; }
+    const char* pthread_attr_setstacksize_error::name() const { return "pthread_attr_setstacksize"; }
     Function pthread_create_error::function() const { return Function::PTHREAD_CREATE; }
     const char* pthread_create_error::name() const { return "pthread_create"; }
     Function pthread_join_error::function() const { return Function::PTHREAD_JOIN; }
@@ -259,12 +301,26 @@ namespace ixxx {
     const char* readlinkat_error::name() const { return "readlinkat"; }
     Function realloc_error::function() const { return Function::REALLOC; }
     const char* realloc_error::name() const { return "realloc"; }
+    Function recv_error::function() const { return Function::RECV; }
+    const char* recv_error::name() const { return "recv"; }
+    Function recvmmsg_error::function() const { return Function::RECVMMSG; }
+    const char* recvmmsg_error::name() const { return "recvmmsg"; }
+    Function recvmsg_error::function() const { return Function::RECVMSG; }
+    const char* recvmsg_error::name() const { return "recvmsg"; }
     Function rename_error::function() const { return Function::RENAME; }
     const char* rename_error::name() const { return "rename"; }
     Function renameat_error::function() const { return Function::RENAMEAT; }
     const char* renameat_error::name() const { return "renameat"; }
     Function rmdir_error::function() const { return Function::RMDIR; }
     const char* rmdir_error::name() const { return "rmdir"; }
+    Function sched_getaffinity_error::function() const { return Function::SCHED_GETAFFINITY; }
+    const char* sched_getaffinity_error::name() const { return "sched_getaffinity"; }
+    Function send_error::function() const { return Function::SEND; }
+    const char* send_error::name() const { return "send"; }
+    Function sendmmsg_error::function() const { return Function::SENDMMSG; }
+    const char* sendmmsg_error::name() const { return "sendmmsg"; }
+    Function sendmsg_error::function() const { return Function::SENDMSG; }
+    const char* sendmsg_error::name() const { return "sendmsg"; }
     Function setenv_error::function() const { return Function::SETENV; }
     const char* setenv_error::name() const { return "setenv"; }
     Function setsockopt_error::function() const { return Function::SETSOCKOPT; }
@@ -279,6 +335,8 @@ namespace ixxx {
     const char* sigprocmask_error::name() const { return "sigprocmask"; }
     Function socket_error::function() const { return Function::SOCKET; }
     const char* socket_error::name() const { return "socket"; }
+    Function socketpair_error::function() const { return Function::SOCKETPAIR; }
+    const char* socketpair_error::name() const { return "socketpair"; }
     Function spawn_error::function() const { return Function::SPAWN; }
     const char* spawn_error::name() const { return "spawn"; }
     Function spawn_file_actions_addclose_error::function() const { return Function::SPAWN_FILE_ACTIONS_ADDCLOSE; }
@@ -48,21 +48,29 @@ namespace ixxx {
     // Autogenerated by mk_boilerplate.py - begin
     enum class Function {
         ACCEPT,
+        ACCEPT4,
         BIND,
         CALLOC,
         CLOCK_GETTIME,
         CLOSE,
+        CLOSE_RANGE,
         CLOSEDIR,
         CONNECT,
+        COPY_FILE_RANGE,
         DUP,
         DUP2,
         EPOLL_CREATE1,
         EPOLL_CTL,
+        EPOLL_PWAIT,
+        EPOLL_PWAIT2,
         EPOLL_WAIT,
         EXECV,
         EXECVP,
         EXECVPE,
         EVENTFD,
+        FALLOCATE,
+        FANOTIFY_INIT,
+        FANOTIFY_MARK,
         FCLOSE,
         FCNTL,
         FDOPEN,
@@ -82,13 +90,18 @@ namespace ixxx {
         GETLINE,
         GETPWNAM_R,
         GETPWUID_R,
+        GETSOCKNAME,
         GETSOCKOPT,
         GMTIME_R,
         IF_NAMETOINDEX,
+        INOTIFY_ADD_WATCH,
+        INOTIFY_INIT1,
+        INOTIFY_RM_WATCH,
         IO_DESTROY,
         IO_GETEVENTS,
         IO_SETUP,
         IO_SUBMIT,
+        IOCTL,
         ISATTY,
         LINK,
         LINKAT,
@@ -102,34 +115,49 @@ namespace ixxx {
         MKDTEMP,
         MKSTEMP,
         MMAP,
+        MPROTECT,
         MSYNC,
         MUNMAP,
         NANOSLEEP,
         OPEN,
         OPENAT,
+        OPENAT2,
         OPENDIR,
         PIPE,
         POLL,
         POSIX_FALLOCATE,
+        PPOLL,
         PRCTL,
         PREAD,
         PTHREAD_ATTR_DESTROY,
         PTHREAD_ATTR_INIT,
         PTHREAD_ATTR_SETAFFINITY_NP,
+        PTHREAD_ATTR_SETGUARDSIZE,
         PTHREAD_ATTR_SETINHERITSCHED,
         PTHREAD_ATTR_SETSCHEDPARAM,
         PTHREAD_ATTR_SETSCHEDPOLICY,
+        PTHREAD_ATTR_SETSTACK,
+        PTHREAD_ATTR_SETSTACKSIZE,
         PTHREAD_CREATE,
         PTHREAD_JOIN,
+        PTHREAD_SETNAME_NP,
+        PTHREAD_SIGMASK,
         PWRITE,
         READ,
         READDIR,
         READLINK,
         READLINKAT,
         REALLOC,
+        RECV,
+        RECVMMSG,
+        RECVMSG,
         RENAME,
         RENAMEAT,
         RMDIR,
+        SCHED_GETAFFINITY,
+        SEND,
+        SENDMMSG,
+        SENDMSG,
         SETENV,
         SETSOCKOPT,
         SHUTDOWN,
@@ -137,6 +165,7 @@ namespace ixxx {
         SIGNALFD,
         SIGPROCMASK,
         SOCKET,
+        SOCKETPAIR,
         SPAWN,
         SPAWN_FILE_ACTIONS_ADDCLOSE,
         SPAWN_FILE_ACTIONS_ADDDUP2,
@@ -164,6 +193,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class accept4_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class bind_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -188,6 +223,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class close_range_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class closedir_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -200,6 +241,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class copy_file_range_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class dup_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -230,6 +277,18 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class epoll_pwait_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class epoll_pwait2_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class epoll_wait_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -260,6 +319,24 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class fallocate_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class fanotify_init_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class fanotify_mark_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class fclose_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -374,6 +451,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class getsockname_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class getsockopt_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -392,6 +475,24 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class inotify_add_watch_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class inotify_init1_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class inotify_rm_watch_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class io_destroy_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -416,6 +517,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class ioctl_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class isatty_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -494,6 +601,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class mprotect_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class msync_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -524,6 +637,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class openat2_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class opendir_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -548,12 +667,30 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class pthread_setname_np_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class pthread_sigmask_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class pwrite_error : public sys_error {
         public:
             using sys_error::sys_error;
             Function function() const override;
             const char* name() const override;
     };
+    class ppoll_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class prctl_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -578,6 +715,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class pthread_attr_setguardsize_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class pthread_attr_setinheritsched_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -596,6 +739,18 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class pthread_attr_setstack_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class pthread_attr_setstacksize_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class pthread_create_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -638,6 +793,24 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class recv_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class recvmmsg_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class recvmsg_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class rename_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -656,6 +829,30 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class sched_getaffinity_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class send_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class sendmmsg_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
+    class sendmsg_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class setenv_error : public sys_error {
         public:
             using sys_error::sys_error;
@@ -698,6 +895,12 @@ namespace ixxx {
             Function function() const override;
             const char* name() const override;
     };
+    class socketpair_error : public sys_error {
+        public:
+            using sys_error::sys_error;
+            Function function() const override;
+            const char* name() const override;
+    };
     class spawn_error : public sys_error {
         public:
             using sys_error::sys_error;
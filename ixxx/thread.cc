@@ -0,0 +1,227 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "thread.hh"
+
+#if defined(__linux__)
+
+#include "posix.hh"
+#include "pthread.hh"
+#include "sys_error.hh"
+
+#include <stdexcept>
+#include <utility>
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        thread::thread() = default;
+
+        thread::thread(thread &&o) noexcept
+            : s_(std::move(o.s_))
+        {
+        }
+
+        thread &thread::operator=(thread &&o)
+        {
+            if (this != &o) {
+                release();
+                s_ = std::move(o.s_);
+            }
+            return *this;
+        }
+
+        thread::~thread()
+        {
+            release();
+        }
+
+        void thread::release() noexcept
+        {
+            if (!s_)
+                return;
+            if (::pthread_equal(::pthread_self(), s_->handle)) {
+                // start() frees the state after the body returned
+                s_->detached = true;
+                ::pthread_detach(s_->handle);
+                s_.release();
+                return;
+            }
+            try {
+                join();
+            } catch (...) {
+            }
+            // i.e. joining failed and the thread might still use it
+            s_.release();
+        }
+
+        pthread_t thread::native_handle() const
+        {
+            if (!s_)
+                throw std::logic_error("thread not joinable");
+            return s_->handle;
+        }
+
+        void *thread::start(void *arg)
+        {
+            state &s = *static_cast<state*>(arg);
+            try {
+                if (!s.name.empty())
+                    posix::pthread_setname_np(::pthread_self(), s.name.c_str());
+                s.f();
+            } catch (...) {
+                s.error = std::current_exception();
+            }
+            if (s.detached)
+                delete &s;
+            return nullptr;
+        }
+
+        void thread::join()
+        {
+            if (!s_)
+                return;
+            // pthread_join() would fail with EDEADLK
+            if (::pthread_equal(::pthread_self(), s_->handle))
+                throw std::logic_error("thread can't join itself");
+            // i.e. the state (and the stack) stays alive if joining fails
+            posix::pthread_join(s_->handle, nullptr);
+            std::unique_ptr<state> s(std::move(s_));
+            if (s->stack)
+                posix::munmap(s->stack, s->stack_len);
+            if (s->error)
+                std::rethrow_exception(s->error);
+        }
+
+
+        thread_builder::thread_builder()
+        {
+            CPU_ZERO(&cpus_);
+        }
+
+        thread_builder &thread_builder::name(const std::string &s)
+        {
+            // cf. pthread_setname_np(3), including the terminating null
+            name_ = s.substr(0, 15);
+            return *this;
+        }
+
+        thread_builder &thread_builder::cpu(int cpu)
+        {
+            // CPU_SET() silently ignores those
+            if (cpu < 0 || cpu >= CPU_SETSIZE)
+                throw pthread_attr_setaffinity_np_error(EINVAL,
+                        "CPU out of range");
+            CPU_SET(cpu, &cpus_);
+            has_cpus_ = true;
+            return *this;
+        }
+
+        thread_builder &thread_builder::affinity(const cpu_set_t &set)
+        {
+            cpus_ = set;
+            has_cpus_ = true;
+            return *this;
+        }
+
+        thread_builder &thread_builder::policy(int policy, int priority)
+        {
+            policy_   = policy;
+            priority_ = priority;
+            return *this;
+        }
+
+        thread_builder &thread_builder::stack_size(size_t n)
+        {
+            stack_size_ = n;
+            return *this;
+        }
+
+        thread_builder &thread_builder::guard_size(size_t n)
+        {
+            guard_size_ = n;
+            guard_set_  = true;
+            return *this;
+        }
+
+        thread_builder &thread_builder::huge_page_stack(bool b)
+        {
+            huge_ = b;
+            return *this;
+        }
+
+        static size_t round_up(size_t n, size_t k)
+        {
+            return (n + k - 1) / k * k;
+        }
+
+        thread thread_builder::spawn(std::function<void()> f) const
+        {
+            std::unique_ptr<thread::state> s(new thread::state());
+            s->f    = std::move(f);
+            s->name = name_;
+            pthread_attr_t attr;
+            posix::pthread_attr_init(&attr);
+            try {
+                if (has_cpus_)
+                    posix::pthread_attr_setaffinity_np(&attr, sizeof cpus_,
+                            &cpus_);
+                if (policy_ != -1) {
+                    posix::pthread_attr_setinheritsched(&attr,
+                            PTHREAD_EXPLICIT_SCHED);
+                    posix::pthread_attr_setschedpolicy(&attr, policy_);
+                    struct sched_param p = sched_param();
+                    p.sched_priority = priority_;
+                    posix::pthread_attr_setschedparam(&attr, &p);
+                }
+                if (huge_) {
+                    const size_t huge = size_t(2) << 20;
+                    size_t page  = posix::sysconf(_SC_PAGESIZE);
+                    size_t size  = round_up(stack_size_ ? stack_size_
+                            : size_t(8) << 20, huge);
+                    size_t guard = round_up(guard_set_ ? guard_size_ : page,
+                            page);
+                    // slack for aligning the stack
+                    s->stack_len = guard + huge + size;
+                    s->stack = posix::mmap(nullptr, s->stack_len,
+                            PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE
+                            | MAP_STACK, -1, 0);
+                    char *p  = static_cast<char*>(s->stack);
+                    char *lo = reinterpret_cast<char*>(round_up(
+                                reinterpret_cast<size_t>(p + guard), huge));
+                    if (guard)
+                        posix::mprotect(lo - guard, guard, PROT_NONE);
+                    // just advisory, e.g. THP might be disabled
+                    ::madvise(lo, size, MADV_HUGEPAGE);
+                    posix::pthread_attr_setstack(&attr, lo, size);
+                } else {
+                    if (stack_size_)
+                        posix::pthread_attr_setstacksize(&attr, stack_size_);
+                    if (guard_set_)
+                        posix::pthread_attr_setguardsize(&attr, guard_size_);
+                }
+                posix::pthread_create(&s->handle, &attr, thread::start, s.get());
+            } catch (...) {
+                ::pthread_attr_destroy(&attr);
+                if (s->stack)
+                    ::munmap(s->stack, s->stack_len);
+                throw;
+            }
+            posix::pthread_attr_destroy(&attr);
+            thread t;
+            t.s_ = std::move(s);
+            return t;
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,118 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_THREAD_HH
+#define IXXX_THREAD_HH
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <stddef.h>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Move-only handle of a thread created by thread_builder.
+        class thread {
+            public:
+                thread();
+                thread(thread &&o) noexcept;
+                // joins the current thread first (if any)
+                thread &operator=(thread &&o);
+                // Joins, i.e. the thread body has to return eventually.
+                // An exception the body threw is dropped, call join()
+                // to receive it. When called from the thread itself it
+                // detaches instead, i.e. the state is released when the
+                // body returns - a stack allocated by us is leaked then.
+                ~thread();
+                thread(const thread &) = delete;
+                thread &operator=(const thread &) = delete;
+
+                bool joinable() const { return !!s_; }
+                // Joins and rethrows the exception the body threw (if any).
+                // Throws std::logic_error when called from the thread
+                // itself, the thread stays joinable, then.
+                void join();
+                // throws std::logic_error if not joinable()
+                pthread_t native_handle() const;
+            private:
+                friend class thread_builder;
+                struct state {
+                    std::function<void()> f;
+                    std::string name;
+                    std::exception_ptr error;
+                    pthread_t handle;
+                    // mapping of a stack allocated by us
+                    void *stack {nullptr};
+                    size_t stack_len {0};
+                    // set by the thread itself, cf. release()
+                    bool detached {false};
+                };
+                static void *start(void *arg);
+                // joins or detaches, doesn't throw
+                void release() noexcept;
+
+                std::unique_ptr<state> s_;
+        };
+
+        // Configures and spawns a thread, e.g.:
+        //
+        //     auto t = util::thread_builder().name("rx").cpu(3)
+        //         .policy(SCHED_FIFO, 10).spawn([]{ ... });
+        //
+        // All attributes are applied with pthread_attr_*() before the
+        // thread is created, i.e. it starts on the right CPU, with the
+        // right policy. Unset attributes keep the defaults.
+        class thread_builder {
+            public:
+                thread_builder();
+
+                // at most 15 characters, longer names are truncated
+                thread_builder &name(const std::string &s);
+                // adds a CPU to the affinity mask, throws if it's
+                // outside of CPU_SETSIZE
+                thread_builder &cpu(int cpu);
+                // replaces the affinity mask
+                thread_builder &affinity(const cpu_set_t &set);
+                // e.g. SCHED_FIFO or SCHED_BATCH, implies
+                // PTHREAD_EXPLICIT_SCHED
+                thread_builder &policy(int policy, int priority = 0);
+                thread_builder &stack_size(size_t n);
+                // size of the inaccessible region below the stack
+                thread_builder &guard_size(size_t n);
+                // Allocates the stack with mmap(), aligned to 2 MiB and
+                // advised for transparent huge pages (MADV_HUGEPAGE),
+                // with an explicit guard region.
+                thread_builder &huge_page_stack(bool b = true);
+
+                thread spawn(std::function<void()> f) const;
+            private:
+                std::string name_;
+                cpu_set_t cpus_;
+                bool has_cpus_ {false};
+                int policy_ {-1};
+                int priority_ {0};
+                // 0 means default
+                size_t stack_size_ {0};
+                size_t guard_size_ {0};
+                bool guard_set_ {false};
+                bool huge_ {false};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_THREAD_HH
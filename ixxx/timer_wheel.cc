@@ -0,0 +1,292 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "timer_wheel.hh"
+
+#if defined(__linux__)
+
+#include "linux.hh"
+#include "posix.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        const uint32_t timer_wheel::nil;
+
+        static int64_t monotonic_ns()
+        {
+            struct timespec ts;
+            posix::clock_gettime(CLOCK_MONOTONIC, &ts);
+            return int64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+        }
+
+        timer_wheel::timer_wheel(std::chrono::nanoseconds resolution)
+            : tfd_(linux::timerfd_create(CLOCK_MONOTONIC,
+                        TFD_NONBLOCK | TFD_CLOEXEC)),
+              resolution_(std::max(int64_t(resolution.count()), int64_t(1))),
+              origin_(monotonic_ns()),
+              heads_(levels * slots_per_level, nil)
+        {
+        }
+
+        uint64_t timer_wheel::now_tick(bool round_up,
+                std::chrono::nanoseconds delay) const
+        {
+            int64_t d = monotonic_ns() - origin_
+                + std::max(int64_t(delay.count()), int64_t(0));
+            if (round_up)
+                d += resolution_ - 1;
+            return d / resolution_;
+        }
+
+        void timer_wheel::insert(uint32_t i)
+        {
+            node &n = nodes_[i];
+            uint64_t delta = n.expires > current_ ? n.expires - current_ : 0;
+            unsigned level = 0;
+            while (level + 1 < levels
+                    && delta >= uint64_t(1) << (level_bits * (level + 1)))
+                ++level;
+            uint32_t slot = level * slots_per_level
+                + ((n.expires >> (level_bits * level)) & (slots_per_level - 1));
+            n.slot = slot;
+            n.prev = nil;
+            n.next = heads_[slot];
+            if (n.next != nil)
+                nodes_[n.next].prev = i;
+            heads_[slot] = i;
+            ++level_size_[level];
+        }
+
+        void timer_wheel::unlink(uint32_t i)
+        {
+            node &n = nodes_[i];
+            if (n.prev != nil)
+                nodes_[n.prev].next = n.next;
+            else
+                heads_[n.slot] = n.next;
+            if (n.next != nil)
+                nodes_[n.next].prev = n.prev;
+            --level_size_[n.slot / slots_per_level];
+        }
+
+        void timer_wheel::release(uint32_t i)
+        {
+            node &n = nodes_[i];
+            n.slot = nil;
+            ++n.gen;
+            n.next = free_;
+            free_ = i;
+            --size_;
+        }
+
+        timer_wheel::timer_id timer_wheel::schedule(std::chrono::nanoseconds delay,
+                callback cb)
+        {
+            // current_ is only advanced by process(), i.e. it's stale
+            // after an idle period and the clamping below would be off
+            if (!size_ && !advancing_)
+                current_ = std::max(current_, now_tick(false));
+            uint64_t e = now_tick(true, delay);
+            e = std::max(e, current_ + 1);
+            e = std::min(e, current_ + UINT32_MAX);
+            uint32_t i;
+            if (free_ != nil) {
+                i = free_;
+                free_ = nodes_[i].next;
+            } else {
+                if (nodes_.size() == nil)
+                    throw std::length_error("too many timers");
+                node n;
+                n.gen = 0;
+                nodes_.push_back(std::move(n));
+                i = nodes_.size() - 1;
+            }
+            node &n = nodes_[i];
+            n.cb      = std::move(cb);
+            n.expires = e;
+            insert(i);
+            ++size_;
+            // advance() walks all ticks up to e, i.e. also
+            // the cascades in between
+            if (!armed_ || e < armed_)
+                arm(e);
+            return uint64_t(n.gen) << 32 | i;
+        }
+
+        bool timer_wheel::cancel(timer_id id)
+        {
+            uint32_t i = uint32_t(id);
+            if (i >= nodes_.size())
+                return false;
+            node &n = nodes_[i];
+            if (n.slot == nil || n.gen != uint32_t(id >> 32))
+                return false;
+            unlink(i);
+            n.cb = callback();
+            release(i);
+            // a spurious wakeup is cheaper than re-arming
+            return true;
+        }
+
+        void timer_wheel::cascade(unsigned level)
+        {
+            uint32_t slot = level * slots_per_level
+                + ((current_ >> (level_bits * level)) & (slots_per_level - 1));
+            uint32_t i = heads_[slot];
+            heads_[slot] = nil;
+            while (i != nil) {
+                uint32_t next = nodes_[i].next;
+                --level_size_[level];
+                insert(i);
+                i = next;
+            }
+        }
+
+        size_t timer_wheel::advance(uint64_t tick)
+        {
+            size_t fired = 0;
+            while (current_ < tick) {
+                if (!size_) {
+                    current_ = tick;
+                    break;
+                }
+                if (!level_size_[0]) {
+                    // nothing expires before the next cascade of the
+                    // lowest non-empty level, i.e. skip to it
+                    unsigned level = 1;
+                    while (level + 1 < levels && !level_size_[level])
+                        ++level;
+                    uint64_t b = ((current_ >> (level_bits * level)) + 1)
+                        << (level_bits * level);
+                    if (b > tick) {
+                        current_ = tick;
+                        break;
+                    }
+                    current_ = b - 1;
+                }
+                ++current_;
+                for (unsigned level = levels - 1; level > 0; --level) {
+                    if (!(current_ & ((uint64_t(1) << (level_bits * level)) - 1)))
+                        cascade(level);
+                }
+                uint32_t slot = current_ & (slots_per_level - 1);
+                while (heads_[slot] != nil) {
+                    uint32_t i = heads_[slot];
+                    unlink(i);
+                    callback cb(std::move(nodes_[i].cb));
+                    nodes_[i].cb = callback();
+                    uint64_t late = tick > nodes_[i].expires
+                        ? tick - nodes_[i].expires : 0;
+                    if (late) {
+                        ++overruns_;
+                        max_late_ = std::max(max_late_, late);
+                    }
+                    release(i);
+                    ++fired;
+                    advancing_ = true;
+                    try {
+                        cb();
+                    } catch (...) {
+                        advancing_ = false;
+                        // the remaining timers of this tick fire
+                        // with the next process() call
+                        --current_;
+                        throw;
+                    }
+                    advancing_ = false;
+                }
+            }
+            return fired;
+        }
+
+        uint64_t timer_wheel::next_tick() const
+        {
+            uint64_t best = 0;
+            if (!size_)
+                return best;
+            for (unsigned level = 0; level < levels; ++level) {
+                if (!level_size_[level])
+                    continue;
+                unsigned shift = level_bits * level;
+                uint64_t base = current_ >> shift;
+                for (uint64_t k = 1; k <= slots_per_level; ++k) {
+                    uint32_t slot = level * slots_per_level
+                        + ((base + k) & (slots_per_level - 1));
+                    if (heads_[slot] != nil) {
+                        uint64_t t = (base + k) << shift;
+                        if (!best || t < best)
+                            best = t;
+                        break;
+                    }
+                }
+            }
+            return best;
+        }
+
+        void timer_wheel::rearm()
+        {
+            uint64_t t = next_tick();
+            if (t != armed_)
+                arm(t);
+        }
+
+        void timer_wheel::arm(uint64_t t)
+        {
+            struct itimerspec its = { { 0, 0 }, { 0, 0 } };
+            if (t) {
+                int64_t ns = origin_ + int64_t(t) * resolution_;
+                its.it_value.tv_sec  = ns / 1000000000;
+                its.it_value.tv_nsec = ns % 1000000000;
+            }
+            linux::timerfd_settime(tfd_.get(), TFD_TIMER_ABSTIME, &its, nullptr);
+            armed_ = t;
+        }
+
+        size_t timer_wheel::process()
+        {
+            // the timerfd is armed one-shot, i.e. the expiration count
+            // is at most 1
+            uint64_t n;
+            ssize_t r = ::read(tfd_.get(), &n, sizeof n);
+            if (r == -1 && errno != EAGAIN)
+                throw read_error(errno);
+            // armed_ is stale after the expiration
+            if (r != -1)
+                armed_ = 0;
+            size_t fired;
+            try {
+                fired = advance(now_tick(false));
+            } catch (...) {
+                rearm();
+                throw;
+            }
+            rearm();
+            return fired;
+        }
+
+        size_t timer_wheel::run_once(int timeout_ms)
+        {
+            struct pollfd p = { tfd_.get(), POLLIN, 0 };
+            if (posix::poll(&p, 1, timeout_ms) != 1)
+                return 0;
+            return process();
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,125 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_TIMER_WHEEL_HH
+#define IXXX_TIMER_WHEEL_HH
+
+#include <ixxx/fd.hh>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Hierarchical timing wheel (4 levels of 256 slots) driven by a
+        // single CLOCK_MONOTONIC timerfd.
+        //
+        // Scheduling and cancelling are O(1), timers are kept in
+        // intrusive lists of a node pool, i.e. after warm-up only
+        // callbacks that don't fit into std::function's small buffer
+        // allocate. Timers of the upper levels are cascaded into the
+        // lower ones as time advances.
+        //
+        // The timerfd is only re-armed when the nearest deadline changes.
+        // It can be registered in an epoll loop (call process() when it's
+        // readable) or used standalone via run_once().
+        //
+        // Delays are rounded up to the resolution and capped at
+        // 2^32 - 1 ticks (e.g. ~49 days with 1 ms resolution).
+        class timer_wheel {
+            public:
+                typedef std::function<void()> callback;
+                typedef uint64_t timer_id;
+
+                explicit timer_wheel(std::chrono::nanoseconds resolution
+                        = std::chrono::milliseconds(1));
+                timer_wheel(const timer_wheel &) = delete;
+                timer_wheel &operator=(const timer_wheel &) = delete;
+
+                // the timerfd, readable when a deadline is reached
+                int fd() const { return tfd_.get(); }
+
+                // the callback may schedule and cancel timers
+                timer_id schedule(std::chrono::nanoseconds delay, callback cb);
+                // returns false if the timer already fired or was cancelled
+                bool cancel(timer_id id);
+                // number of scheduled timers
+                size_t size() const { return size_; }
+
+                // Consumes the timerfd expirations and fires the expired
+                // timers, returns the number of fired timers.
+                size_t process();
+                // Waits at most timeout_ms (-1 means infinite) for the next
+                // deadline and calls process().
+                size_t run_once(int timeout_ms = -1);
+
+                // Number of timers that fired at least one tick after
+                // their deadline, e.g. because process() was called late
+                // or a previous callback stalled the loop.
+                uint64_t overruns() const { return overruns_; }
+                // largest delay between deadline and firing so far
+                std::chrono::nanoseconds max_lateness() const
+                {
+                    return std::chrono::nanoseconds(max_late_ * resolution_);
+                }
+            private:
+                enum { level_bits = 8, slots_per_level = 1 << level_bits,
+                    levels = 4 };
+                static const uint32_t nil = UINT32_MAX;
+                struct node {
+                    callback cb;
+                    uint64_t expires;
+                    uint32_t prev;
+                    uint32_t next;
+                    // slot index in heads_ or nil if the node is free
+                    uint32_t slot;
+                    uint32_t gen;
+                };
+
+                uint64_t now_tick(bool round_up, std::chrono::nanoseconds delay
+                        = std::chrono::nanoseconds(0)) const;
+                void insert(uint32_t i);
+                void unlink(uint32_t i);
+                void release(uint32_t i);
+                void cascade(unsigned level);
+                size_t advance(uint64_t tick);
+                // nearest tick at which something has to be done
+                uint64_t next_tick() const;
+                void rearm();
+                // 0 disarms
+                void arm(uint64_t tick);
+
+                unique_fd tfd_;
+                int64_t resolution_;
+                int64_t origin_;
+                // last processed tick
+                uint64_t current_ {0};
+                // 0 means disarmed
+                uint64_t armed_ {0};
+                std::vector<node> nodes_;
+                uint32_t free_ {nil};
+                std::vector<uint32_t> heads_;
+                size_t level_size_[levels] = { 0 };
+                size_t size_ {0};
+                uint64_t overruns_ {0};
+                // in ticks
+                uint64_t max_late_ {0};
+                // set while advance() fires timers
+                bool advancing_ {false};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_TIMER_WHEEL_HH
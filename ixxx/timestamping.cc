@@ -0,0 +1,123 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "timestamping.hh"
+
+#if defined(__linux__)
+
+#include "socket.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <string.h>
+#include <netinet/in.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        void set_timestamping(int fd, unsigned flags)
+        {
+            posix::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof flags);
+        }
+
+        void set_timestampns(int fd, bool on)
+        {
+            int v = on;
+            posix::setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &v, sizeof v);
+        }
+
+        static bool zero(const struct timespec &t)
+        {
+            return !t.tv_sec && !t.tv_nsec;
+        }
+
+        bool get_timestamps(const struct msghdr &h, packet_timestamps &ts)
+        {
+            ts = packet_timestamps();
+            for (struct cmsghdr *c = CMSG_FIRSTHDR(&h); c;
+                    c = CMSG_NXTHDR(const_cast<struct msghdr*>(&h), c)) {
+                if (c->cmsg_level != SOL_SOCKET)
+                    continue;
+                if (c->cmsg_type == SCM_TIMESTAMPING) {
+                    struct scm_timestamping t;
+                    memcpy(&t, CMSG_DATA(c), sizeof t);
+                    // ts[1] is deprecated and always zero
+                    if (!zero(t.ts[0])) {
+                        ts.software = t.ts[0];
+                        ts.has_software = true;
+                    }
+                    if (!zero(t.ts[2])) {
+                        ts.hardware = t.ts[2];
+                        ts.has_hardware = true;
+                    }
+                } else if (c->cmsg_type == SCM_TIMESTAMPNS) {
+                    memcpy(&ts.software, CMSG_DATA(c), sizeof ts.software);
+                    ts.has_software = true;
+                }
+            }
+            return ts.has_software || ts.has_hardware;
+        }
+
+        bool read_tx_timestamp(int fd, tx_timestamp &t)
+        {
+            for (;;) {
+                union {
+                    char buf[CMSG_SPACE(sizeof(struct scm_timestamping))
+                        + CMSG_SPACE(sizeof(struct sock_extended_err)
+                                + sizeof(struct sockaddr_in6))];
+                    struct cmsghdr align;
+                } control;
+                struct msghdr h = msghdr();
+                h.msg_control    = control.buf;
+                h.msg_controllen = sizeof control.buf;
+                ssize_t r = ::recvmsg(fd, &h, MSG_ERRQUEUE);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return false;
+                    throw recvmsg_error(errno);
+                }
+                t = tx_timestamp();
+                bool have_err = false;
+                for (struct cmsghdr *c = CMSG_FIRSTHDR(&h); c;
+                        c = CMSG_NXTHDR(&h, c)) {
+                    if (!((c->cmsg_level == SOL_IP && c->cmsg_type == IP_RECVERR)
+                            || (c->cmsg_level == SOL_IPV6
+                                && c->cmsg_type == IPV6_RECVERR)))
+                        continue;
+                    struct sock_extended_err e;
+                    memcpy(&e, CMSG_DATA(c), sizeof e);
+                    if (e.ee_origin != SO_EE_ORIGIN_TIMESTAMPING
+                            || e.ee_errno != ENOMSG)
+                        continue;
+                    t.id   = e.ee_data;
+                    t.type = e.ee_info;
+                    have_err = true;
+                }
+                if (have_err && get_timestamps(h, t.ts))
+                    return true;
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
+
+namespace ixxx {
+
+    namespace util {
+
+        int64_t diff_ns(const struct timespec &begin, const struct timespec &end)
+        {
+            return (int64_t(end.tv_sec) - int64_t(begin.tv_sec)) * 1000000000
+                + (int64_t(end.tv_nsec) - int64_t(begin.tv_nsec));
+        }
+
+    }
+
+}
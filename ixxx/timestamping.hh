@@ -0,0 +1,86 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_TIMESTAMPING_HH
+#define IXXX_TIMESTAMPING_HH
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Enables SO_TIMESTAMPING with SOF_TIMESTAMPING_* flags, e.g.
+        //
+        //     SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE
+        //
+        // for software receive timestamps or
+        //
+        //     SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE
+        //         | SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY
+        //
+        // for numbered software transmit timestamps on the error queue.
+        // Hardware timestamps additionally require SIOCSHWTSTAMP on
+        // the device.
+        void set_timestamping(int fd, unsigned flags);
+        // Enables SO_TIMESTAMPNS, i.e. a software receive timestamp
+        // with nanosecond resolution for each received message.
+        void set_timestampns(int fd, bool on = true);
+
+        // Space for the control buffer of recvmsg() that is sufficient
+        // for receive timestamps.
+        constexpr size_t timestamp_cmsg_space =
+            CMSG_SPACE(sizeof(struct scm_timestamping))
+            + CMSG_SPACE(sizeof(struct timespec));
+
+        struct packet_timestamps {
+            // from SCM_TIMESTAMPING or SCM_TIMESTAMPNS
+            struct timespec software;
+            // raw hardware timestamp
+            struct timespec hardware;
+            bool has_software;
+            bool has_hardware;
+        };
+
+        // Extracts the timestamps from the control messages of a
+        // recvmsg() result, returns false if there are none.
+        bool get_timestamps(const struct msghdr &h, packet_timestamps &ts);
+
+        struct tx_timestamp {
+            // with SOF_TIMESTAMPING_OPT_ID: the byte offset (TCP) or the
+            // packet counter (UDP) of the send, starting with 0
+            uint32_t id;
+            // SCM_TSTAMP_SND, SCM_TSTAMP_SCHED or SCM_TSTAMP_ACK
+            uint32_t type;
+            packet_timestamps ts;
+        };
+
+        // Reads one transmit timestamp from the error queue, returns
+        // false if there is none available. Other error queue messages
+        // (e.g. ICMP errors) are skipped.
+        //
+        // The error queue signals EPOLLERR, i.e. call this in a loop
+        // when epoll_wait() returns EPOLLERR for the socket.
+        bool read_tx_timestamp(int fd, tx_timestamp &t);
+
+#endif
+
+        // end - begin in nanoseconds
+        int64_t diff_ns(const struct timespec &begin, const struct timespec &end);
+
+    }
+
+}
+
+#endif // IXXX_TIMESTAMPING_HH
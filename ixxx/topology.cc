@@ -0,0 +1,261 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "topology.hh"
+
+#if defined(__linux__)
+
+#include "fd.hh"
+#include "linux.hh"
+#include "posix.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <set>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        // sysfs attributes are small, returns an empty string
+        // if the file doesn't exist
+        static std::string read_attr(const std::string &path)
+        {
+            unique_fd f;
+            try {
+                f.reset(posix::open(path, O_RDONLY | O_CLOEXEC));
+            } catch (const open_error &e) {
+                if (e.code() == ENOENT)
+                    return std::string();
+                throw;
+            }
+            std::string s;
+            char buf[4096];
+            for (;;) {
+                ssize_t r = posix::read(f.get(), buf, sizeof buf);
+                if (!r)
+                    break;
+                s.append(buf, r);
+            }
+            while (!s.empty() && (s.back() == '\n' || s.back() == ' '))
+                s.pop_back();
+            return s;
+        }
+
+        static int read_int(const std::string &path, int def)
+        {
+            std::string s(read_attr(path));
+            if (s.empty())
+                return def;
+            return atoi(s.c_str());
+        }
+
+        // The kernel fails with EINVAL if the mask is smaller than its
+        // cpumask, i.e. with more than CPU_SETSIZE possible CPUs, thus
+        // retry with dynamically sized sets.
+        static std::vector<int> affinity()
+        {
+            for (int n = CPU_SETSIZE; ; n *= 2) {
+                std::unique_ptr<cpu_set_t, void(*)(cpu_set_t*)> set(
+                        CPU_ALLOC(n), [](cpu_set_t *p) { CPU_FREE(p); });
+                if (!set)
+                    throw std::bad_alloc();
+                size_t len = CPU_ALLOC_SIZE(n);
+                try {
+                    linux::sched_getaffinity(0, len, set.get());
+                } catch (const sched_getaffinity_error &e) {
+                    if (e.code() == EINVAL && n < (1 << 20))
+                        continue;
+                    throw;
+                }
+                std::vector<int> v;
+                for (int i = 0; i < n; ++i) {
+                    if (CPU_ISSET_S(i, len, set.get()))
+                        v.push_back(i);
+                }
+                return v;
+            }
+        }
+
+        std::vector<int> topology::parse_cpu_list(const std::string &s)
+        {
+            std::vector<int> v;
+            const char *p = s.c_str();
+            while (*p) {
+                char *e;
+                long a = strtol(p, &e, 10);
+                if (e == p)
+                    break;
+                long b = a;
+                p = e;
+                if (*p == '-') {
+                    b = strtol(p + 1, &e, 10);
+                    p = e;
+                }
+                for (long i = a; i <= b; ++i)
+                    v.push_back(int(i));
+                if (*p != ',')
+                    break;
+                ++p;
+            }
+            return v;
+        }
+
+        cpu_set_t topology::to_cpu_set(const std::vector<int> &cpus)
+        {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            for (int c : cpus) {
+                if (c >= 0 && c < CPU_SETSIZE)
+                    CPU_SET(c, &set);
+            }
+            return set;
+        }
+
+        topology::topology(const std::string &sysfs, const cpu_set_t *allowed)
+        {
+            std::vector<int> mask;
+            if (allowed) {
+                for (int i = 0; i < CPU_SETSIZE; ++i) {
+                    if (CPU_ISSET(i, allowed))
+                        mask.push_back(i);
+                }
+            } else {
+                mask = affinity();
+            }
+            std::string cpu_dir(sysfs + "/cpu/");
+            for (int id : parse_cpu_list(read_attr(cpu_dir + "online"))) {
+                std::string d(cpu_dir + "cpu" + std::to_string(id) + "/");
+                cpu_info c;
+                c.id      = id;
+                c.core    = read_int(d + "topology/core_id", id);
+                c.package = read_int(d + "topology/physical_package_id", 0);
+                c.node    = 0;
+                c.allowed = std::binary_search(mask.begin(), mask.end(), id);
+                c.siblings = parse_cpu_list(
+                        read_attr(d + "topology/thread_siblings_list"));
+                if (c.siblings.empty())
+                    c.siblings.push_back(id);
+                for (unsigned i = 0; ; ++i) {
+                    std::string x(d + "cache/index" + std::to_string(i) + "/");
+                    std::string level(read_attr(x + "level"));
+                    if (level.empty())
+                        break;
+                    if (read_attr(x + "type") == "Instruction")
+                        continue;
+                    std::string shared(read_attr(x + "shared_cpu_list"));
+                    if (level == "2")
+                        c.l2 = parse_cpu_list(shared);
+                    else if (level == "3")
+                        c.l3 = parse_cpu_list(shared);
+                }
+                // e.g. no cache/ directory in some VMs
+                if (c.l2.empty())
+                    c.l2.push_back(id);
+                if (c.l3.empty())
+                    c.l3.push_back(id);
+                cpus_.push_back(std::move(c));
+            }
+            std::string node_dir(sysfs + "/node/");
+            for (int n : parse_cpu_list(read_attr(node_dir + "online"))) {
+                for (int id : parse_cpu_list(read_attr(node_dir + "node"
+                                + std::to_string(n) + "/cpulist"))) {
+                    auto i = std::lower_bound(cpus_.begin(), cpus_.end(), id,
+                            [](const cpu_info &c, int id) { return c.id < id; });
+                    if (i != cpus_.end() && i->id == id)
+                        i->node = n;
+                }
+            }
+        }
+
+        const cpu_info *topology::cpu(int id) const
+        {
+            auto i = std::lower_bound(cpus_.begin(), cpus_.end(), id,
+                    [](const cpu_info &c, int id) { return c.id < id; });
+            if (i == cpus_.end() || i->id != id)
+                return nullptr;
+            return &*i;
+        }
+
+        std::vector<int> topology::filter(const std::vector<int> &v) const
+        {
+            std::vector<int> r;
+            for (int id : v) {
+                const cpu_info *c = cpu(id);
+                if (c && c->allowed)
+                    r.push_back(id);
+            }
+            return r;
+        }
+
+        std::vector<int> topology::allowed() const
+        {
+            std::vector<int> r;
+            for (auto &c : cpus_) {
+                if (c.allowed)
+                    r.push_back(c.id);
+            }
+            return r;
+        }
+
+        std::vector<int> topology::one_per_core() const
+        {
+            std::set<std::pair<int, int>> seen;
+            std::vector<int> r;
+            for (auto &c : cpus_) {
+                if (c.allowed && seen.insert(std::make_pair(c.package,
+                                c.core)).second)
+                    r.push_back(c.id);
+            }
+            return r;
+        }
+
+        std::vector<int> topology::siblings(int cpu) const
+        {
+            const cpu_info *c = this->cpu(cpu);
+            return c ? filter(c->siblings) : std::vector<int>();
+        }
+
+        std::vector<int> topology::sharing_l2(int cpu) const
+        {
+            const cpu_info *c = this->cpu(cpu);
+            return c ? filter(c->l2) : std::vector<int>();
+        }
+
+        std::vector<int> topology::sharing_l3(int cpu) const
+        {
+            const cpu_info *c = this->cpu(cpu);
+            return c ? filter(c->l3) : std::vector<int>();
+        }
+
+        std::vector<int> topology::node_cpus(int node) const
+        {
+            std::vector<int> r;
+            for (auto &c : cpus_) {
+                if (c.allowed && c.node == node)
+                    r.push_back(c.id);
+            }
+            return r;
+        }
+
+        std::vector<int> topology::nodes() const
+        {
+            std::set<int> s;
+            for (auto &c : cpus_)
+                s.insert(c.node);
+            return std::vector<int>(s.begin(), s.end());
+        }
+
+    }
+
+}
+
+#endif // __linux__
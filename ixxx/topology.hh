@@ -0,0 +1,85 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_TOPOLOGY_HH
+#define IXXX_TOPOLOGY_HH
+
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        struct cpu_info {
+            int id;
+            // physical core, unique per package
+            int core;
+            int package;
+            // NUMA node, 0 without NUMA support
+            int node;
+            // member of the affinity mask, i.e. usable by this process
+            bool allowed;
+            // The CPU lists include the CPU itself, i.e. they just
+            // contain the CPU if sysfs doesn't provide the information.
+            std::vector<int> siblings;
+            std::vector<int> l2;
+            std::vector<int> l3;
+        };
+
+        // Snapshot of the CPU topology of the online CPUs as reported by
+        // sysfs (cpu/cpuN/topology, cpu/cpuN/cache, node/nodeN).
+        //
+        // CPUs that aren't in the affinity mask (cf. sched_getaffinity(),
+        // which also reflects cgroup cpusets) are included but marked as
+        // not allowed. The placement helpers only return allowed CPUs,
+        // sorted by id, e.g. for to_cpu_set() and
+        // pthread_attr_setaffinity_np(). Note that a cpu_set_t is limited
+        // to CPU_SETSIZE CPUs, i.e. to_cpu_set() ignores larger ids.
+        class topology {
+            public:
+                // allowed == nullptr means the affinity mask
+                // of the calling thread
+                explicit topology(const std::string &sysfs
+                        = "/sys/devices/system",
+                        const cpu_set_t *allowed = nullptr);
+
+                // online CPUs, sorted by id
+                const std::vector<cpu_info> &cpus() const { return cpus_; }
+                // nullptr if the CPU isn't online
+                const cpu_info *cpu(int id) const;
+
+                std::vector<int> allowed() const;
+                // first allowed CPU of each physical core, i.e. without
+                // SMT siblings
+                std::vector<int> one_per_core() const;
+                std::vector<int> siblings(int cpu) const;
+                std::vector<int> sharing_l2(int cpu) const;
+                std::vector<int> sharing_l3(int cpu) const;
+                std::vector<int> node_cpus(int node) const;
+                // NUMA nodes with online CPUs
+                std::vector<int> nodes() const;
+
+                static cpu_set_t to_cpu_set(const std::vector<int> &cpus);
+                // parses the kernel's CPU list format, e.g. "0-3,8,10-11"
+                static std::vector<int> parse_cpu_list(const std::string &s);
+            private:
+                std::vector<int> filter(const std::vector<int> &v) const;
+
+                std::vector<cpu_info> cpus_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_TOPOLOGY_HH
@@ -0,0 +1,200 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "udp_offload.hh"
+
+#if defined(__linux__)
+
+#include "socket.hh"
+#include "sys_error.hh"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <string.h>
+#include <netinet/in.h>
+#include <netinet/udp.h>
+
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+        // maximum UDP payload over IPv4
+        static const size_t max_udp_payload = 65507;
+        // cf. UDP_MAX_SEGMENTS in the kernel's include/linux/udp.h,
+        // sendmsg() fails with EINVAL for more
+        static const size_t max_udp_segments = 64;
+
+        void set_udp_segment(int fd, uint16_t segment_size)
+        {
+            int v = segment_size;
+            posix::setsockopt(fd, SOL_UDP, UDP_SEGMENT, &v, sizeof v);
+        }
+        void set_udp_gro(int fd, bool on)
+        {
+            int v = on;
+            posix::setsockopt(fd, SOL_UDP, UDP_GRO, &v, sizeof v);
+        }
+
+        void put_udp_segment_cmsg(struct msghdr &h, char *buf,
+                uint16_t segment_size)
+        {
+            h.msg_control    = buf;
+            h.msg_controllen = udp_segment_cmsg_space;
+            struct cmsghdr *c = CMSG_FIRSTHDR(&h);
+            c->cmsg_level = SOL_UDP;
+            c->cmsg_type  = UDP_SEGMENT;
+            c->cmsg_len   = CMSG_LEN(sizeof segment_size);
+            memcpy(CMSG_DATA(c), &segment_size, sizeof segment_size);
+        }
+
+        uint16_t get_udp_gro_cmsg(const struct msghdr &h)
+        {
+            for (struct cmsghdr *c = CMSG_FIRSTHDR(&h); c;
+                    c = CMSG_NXTHDR(const_cast<struct msghdr*>(&h), c)) {
+                if (c->cmsg_level == SOL_UDP && c->cmsg_type == UDP_GRO) {
+                    int v = 0;
+                    memcpy(&v, CMSG_DATA(c), sizeof v);
+                    return v;
+                }
+            }
+            return 0;
+        }
+
+
+        gso_sender::gso_sender(size_t segment_size, size_t max_segments)
+            : seg_size_(std::max(segment_size, size_t(1))),
+              max_(std::max(std::min(std::min(max_segments, max_udp_segments),
+                              max_udp_payload / seg_size_), size_t(1))),
+              buf_(new char[seg_size_ * max_])
+        {
+        }
+
+        char *gso_sender::prepare()
+        {
+            if (count_ == max_ || closed_)
+                return nullptr;
+            return buf_.get() + len_;
+        }
+        void gso_sender::commit(size_t len)
+        {
+            if (count_ == max_ || closed_)
+                throw sendmsg_error(ENOBUFS, "GSO buffer is full");
+            if (len > seg_size_)
+                throw sendmsg_error(EMSGSIZE);
+            len_ += len;
+            ++count_;
+            if (len < seg_size_)
+                closed_ = true;
+        }
+        bool gso_sender::push(const void *p, size_t len)
+        {
+            char *b = prepare();
+            if (!b)
+                return false;
+            if (len > seg_size_)
+                throw sendmsg_error(EMSGSIZE);
+            memcpy(b, p, len);
+            commit(len);
+            return true;
+        }
+
+        size_t gso_sender::send(int fd, const struct sockaddr *dst,
+                socklen_t dstlen, int flags)
+        {
+            if (!count_)
+                return 0;
+            struct iovec iov;
+            iov.iov_base = buf_.get();
+            iov.iov_len  = len_;
+            struct msghdr h = msghdr();
+            h.msg_name    = const_cast<struct sockaddr*>(dst);
+            h.msg_namelen = dstlen;
+            h.msg_iov     = &iov;
+            h.msg_iovlen  = 1;
+            union {
+                char buf[CMSG_SPACE(sizeof(uint16_t))];
+                struct cmsghdr align;
+            } control;
+            // a single datagram doesn't need segmentation
+            if (count_ > 1)
+                put_udp_segment_cmsg(h, control.buf, seg_size_);
+            for (;;) {
+                ssize_t r = ::sendmsg(fd, &h, flags);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return 0;
+                    throw sendmsg_error(errno);
+                }
+                break;
+            }
+            size_t n = count_;
+            clear();
+            return n;
+        }
+
+        void gso_sender::clear()
+        {
+            count_  = 0;
+            len_    = 0;
+            closed_ = false;
+        }
+
+
+        gro_receiver::gro_receiver(size_t buffer_size)
+            : size_(buffer_size),
+              buf_(new char[size_])
+        {
+        }
+
+        ssize_t gro_receiver::recv_raw(int fd, int flags, size_t &segment_size)
+        {
+            struct iovec iov;
+            iov.iov_base = buf_.get();
+            iov.iov_len  = size_;
+            struct msghdr h = msghdr();
+            h.msg_name    = &addr_;
+            h.msg_namelen = sizeof addr_;
+            h.msg_iov     = &iov;
+            h.msg_iovlen  = 1;
+            union {
+                char buf[CMSG_SPACE(sizeof(int))];
+                struct cmsghdr align;
+            } control;
+            h.msg_control    = control.buf;
+            h.msg_controllen = sizeof control.buf;
+            truncated_ = false;
+            for (;;) {
+                ssize_t r = ::recvmsg(fd, &h, flags);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        return -1;
+                    throw recvmsg_error(errno);
+                }
+                addrlen_   = h.msg_namelen;
+                truncated_ = h.msg_flags & MSG_TRUNC;
+                segment_size = get_udp_gro_cmsg(h);
+                return r;
+            }
+        }
+
+    }
+
+}
+
+#endif // __linux__
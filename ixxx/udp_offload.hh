@@ -0,0 +1,137 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_UDP_OFFLOAD_HH
+#define IXXX_UDP_OFFLOAD_HH
+
+#include <algorithm>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <sys/types.h>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // UDP segmentation offload (UDP_SEGMENT, Linux >= 4.18), i.e. sets
+        // the default segment size for all sends on the socket.
+        // A segment size of 0 disables it.
+        void set_udp_segment(int fd, uint16_t segment_size);
+        // UDP generic receive offload (UDP_GRO, Linux >= 5.0), i.e. the
+        // kernel may coalesce consecutive datagrams of the same flow
+        void set_udp_gro(int fd, bool on = true);
+
+        // Adds a UDP_SEGMENT control message to h, where buf must be
+        // at least udp_segment_cmsg_space bytes large
+        // (and suitably aligned for a struct cmsghdr).
+        void put_udp_segment_cmsg(struct msghdr &h, char *buf,
+                uint16_t segment_size);
+        constexpr size_t udp_segment_cmsg_space = CMSG_SPACE(sizeof(uint16_t));
+        // Returns the segment size from a UDP_GRO control message,
+        // or 0 if the message doesn't contain one.
+        uint16_t get_udp_gro_cmsg(const struct msghdr &h);
+
+        // Composes equal-sized datagrams (only the last one may be
+        // shorter) in one buffer that is sent with a single sendmsg()
+        // and a UDP_SEGMENT control message, i.e. the kernel (or NIC)
+        // splits it into separate datagrams.
+        class gso_sender {
+            public:
+                // the number of segments is capped such that all of them
+                // fit into one UDP datagram (64 KiB) and to the kernel's
+                // limit of 64 segments (UDP_MAX_SEGMENTS)
+                explicit gso_sender(size_t segment_size, size_t max_segments = 64);
+                gso_sender(const gso_sender &) = delete;
+                gso_sender &operator=(const gso_sender &) = delete;
+
+                size_t segment_size() const { return seg_size_; }
+                size_t capacity() const { return max_; }
+                // number of queued segments
+                size_t size() const { return count_; }
+
+                // returns nullptr if full or after a short segment
+                char *prepare();
+                // a segment shorter than segment_size() must be the last one
+                void commit(size_t len);
+                // returns false if the segment can't be queued anymore
+                bool push(const void *p, size_t len);
+
+                // Sends all queued segments as one sendmsg() call, returns
+                // the number of segments sent (0 on EAGAIN).
+                size_t send(int fd, const struct sockaddr *dst = nullptr,
+                        socklen_t dstlen = 0, int flags = 0);
+                void clear();
+            private:
+                size_t seg_size_;
+                size_t max_;
+                size_t count_ {0};
+                size_t len_ {0};
+                bool closed_ {false};
+                std::unique_ptr<char[]> buf_;
+        };
+
+        // Receives (possibly coalesced) datagrams on a socket with
+        // UDP_GRO enabled and splits the super-buffers back into the
+        // original datagrams.
+        class gro_receiver {
+            public:
+                explicit gro_receiver(size_t buffer_size = 65535);
+                gro_receiver(const gro_receiver &) = delete;
+                gro_receiver &operator=(const gro_receiver &) = delete;
+
+                // Receives one buffer and calls f(const char *p, size_t n)
+                // for each datagram in it. Returns the number of datagrams,
+                // i.e. 0 if nothing is available (EAGAIN).
+                //
+                // If the buffer is too small, the kernel truncates it
+                // (MSG_TRUNC) and truncated() returns true until the next
+                // call, i.e. the last datagram passed to f is incomplete
+                // or further datagrams of the buffer were dropped.
+                template <typename F> size_t recv(int fd, F f, int flags = 0)
+                {
+                    size_t seg = 0;
+                    ssize_t r = recv_raw(fd, flags, seg);
+                    if (r == -1)
+                        return 0;
+                    size_t n = r;
+                    if (!seg || n <= seg) {
+                        f(static_cast<const char*>(buf_.get()), n);
+                        return 1;
+                    }
+                    size_t k = 0;
+                    for (size_t off = 0; off < n; off += seg, ++k)
+                        f(static_cast<const char*>(buf_.get() + off),
+                                std::min(seg, n - off));
+                    return k;
+                }
+                // source address of the last received buffer
+                const struct sockaddr_storage &addr() const { return addr_; }
+                socklen_t addrlen() const { return addrlen_; }
+                bool truncated() const { return truncated_; }
+            private:
+                // returns -1 on EAGAIN
+                ssize_t recv_raw(int fd, int flags, size_t &segment_size);
+
+                size_t size_;
+                std::unique_ptr<char[]> buf_;
+                struct sockaddr_storage addr_;
+                socklen_t addrlen_ {0};
+                bool truncated_ {false};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_UDP_OFFLOAD_HH
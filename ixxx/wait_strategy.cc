@@ -0,0 +1,75 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "wait_strategy.hh"
+
+#if defined(__linux__)
+
+#include "posix.hh"
+
+#include <algorithm>
+
+#include <time.h>
+
+namespace ixxx {
+
+    namespace util {
+
+        wait_strategy::wait_strategy()
+            : wait_strategy(config())
+        {
+        }
+
+        wait_strategy::wait_strategy(const config &c)
+            : cfg_(c)
+        {
+            cfg_.min_spin = std::max(cfg_.min_spin, std::chrono::nanoseconds(0));
+            cfg_.max_spin = std::max(cfg_.max_spin, cfg_.min_spin);
+            budget_ = cfg_.max_spin.count();
+        }
+
+        int64_t wait_strategy::now_ns()
+        {
+            struct timespec ts;
+            posix::clock_gettime(CLOCK_MONOTONIC, &ts);
+            return int64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+        }
+
+        int64_t wait_strategy::cpu_ns()
+        {
+            struct timespec ts;
+            posix::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+            return int64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+        }
+
+        void wait_strategy::update(int64_t idle)
+        {
+            idle_.add(uint64_t(idle));
+            // exponential moving average with weight 1/8
+            avg_idle_ += (idle - avg_idle_) / 8;
+            int64_t lo = cfg_.min_spin.count();
+            int64_t hi = cfg_.max_spin.count();
+            if (avg_idle_ <= hi)
+                budget_ = std::min(std::max(2 * avg_idle_, lo), hi);
+            else
+                budget_ = lo;
+        }
+
+        size_t wait_strategy::run_once(reactor &r, int timeout_ms)
+        {
+            return wait([&r] { return r.run_once(0); },
+                    [&r, timeout_ms] { return r.run_once(timeout_ms); });
+        }
+
+        void wait_strategy::clear_stats()
+        {
+            stats_ = statistics();
+            idle_.clear();
+        }
+
+    }
+
+}
+
+#endif // __linux__
@@ -0,0 +1,166 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_WAIT_STRATEGY_HH
+#define IXXX_WAIT_STRATEGY_HH
+
+#include <ixxx/histogram.hh>
+
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <ixxx/event_queue.hh>
+#include <ixxx/reactor.hh>
+
+#include <sched.h>
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Spins on a non-blocking poll for a limited budget before it
+        // falls back to a blocking wait, for latency-critical loops.
+        //
+        // The budget adapts to the recent idle times, i.e. the time
+        // between entering wait() and work showing up: while work
+        // typically arrives within max_spin, the budget is twice the
+        // moving average, otherwise it drops to min_spin, as spinning
+        // would just burn CPU time.
+        //
+        // Between polls it executes a CPU pause instruction, after
+        // pause_polls polls it yields the CPU instead.
+        //
+        // Not thread-safe, i.e. use one instance per thread - thus,
+        // the statistics are per thread, too.
+        class wait_strategy {
+            public:
+                struct config {
+                    std::chrono::nanoseconds min_spin {0};
+                    std::chrono::nanoseconds max_spin {50000};
+                    unsigned pause_polls {128};
+                };
+                struct statistics {
+                    // work was available right away
+                    uint64_t immediate {0};
+                    // work arrived while spinning
+                    uint64_t spin_hits {0};
+                    // the spin budget expired
+                    uint64_t spin_misses {0};
+                    // blocking waits, i.e. spin misses and zero budgets
+                    uint64_t sleeps {0};
+                    // CPU time spent spinning (CLOCK_THREAD_CPUTIME_ID),
+                    // i.e. excluding the time the thread wasn't
+                    // scheduled (e.g. after sched_yield())
+                    uint64_t spin_ns {0};
+                };
+
+                wait_strategy();
+                explicit wait_strategy(const config &c);
+
+                // poll() checks for work without blocking (e.g. by
+                // calling epoll_wait() with a zero timeout or by
+                // inspecting a shared-memory flag) and returns the
+                // amount of work that was found (or processed).
+                // block() waits for work and returns the same.
+                // Returns what the successful call returned.
+                template <typename Poll, typename Block>
+                size_t wait(Poll poll, Block block)
+                {
+                    int64_t start = now_ns();
+                    size_t n = poll();
+                    if (n) {
+                        // says nothing about how long to spin
+                        ++stats_.immediate;
+                        return n;
+                    }
+                    int64_t t = start;
+                    if (budget_) {
+                        int64_t cpu = cpu_ns();
+                        int64_t end = start + budget_;
+                        unsigned i = 0;
+                        do {
+                            if (i < cfg_.pause_polls) {
+                                cpu_relax();
+                                ++i;
+                            } else {
+                                ::sched_yield();
+                            }
+                            n = poll();
+                            t = now_ns();
+                        } while (!n && t < end);
+                        stats_.spin_ns += uint64_t(cpu_ns() - cpu);
+                        if (n) {
+                            ++stats_.spin_hits;
+                            update(t - start);
+                            return n;
+                        }
+                        ++stats_.spin_misses;
+                    }
+                    ++stats_.sleeps;
+                    n = block();
+                    // a timeout says nothing about the arrival times
+                    if (n)
+                        update(now_ns() - start);
+                    return n;
+                }
+
+                // waits for and dispatches one batch of reactor events
+                size_t run_once(reactor &r, int timeout_ms = -1);
+
+                // waits for items and calls f for each of them
+                template <typename T, typename F>
+                size_t drain(event_queue<T> &q, F f, int timeout_ms = -1)
+                {
+                    return wait([&q, &f] { return q.drain(f); },
+                            [&q, &f, timeout_ms] {
+                                q.wait(timeout_ms);
+                                return q.drain(f);
+                            });
+                }
+
+                // current spin budget
+                std::chrono::nanoseconds spin_budget() const
+                {
+                    return std::chrono::nanoseconds(budget_);
+                }
+                const statistics &stats() const { return stats_; }
+                // idle times in nanoseconds
+                const latency_histogram &idle_times() const { return idle_; }
+                void clear_stats();
+
+                static void cpu_relax()
+                {
+#if defined(__x86_64__) || defined(__i386__)
+                    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+                    asm volatile("yield" ::: "memory");
+#endif
+                }
+            private:
+                // CLOCK_MONOTONIC, for the budget and the idle times
+                static int64_t now_ns();
+                // CLOCK_THREAD_CPUTIME_ID
+                static int64_t cpu_ns();
+                void update(int64_t idle);
+
+                config cfg_;
+                int64_t budget_ {0};
+                // moving average of the idle times
+                int64_t avg_idle_ {0};
+                statistics stats_;
+                latency_histogram idle_;
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_WAIT_STRATEGY_HH
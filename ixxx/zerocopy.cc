@@ -0,0 +1,128 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include "zerocopy.hh"
+
+#if defined(__linux__)
+
+#include "socket.hh"
+#include "sys_error.hh"
+
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+
+namespace ixxx {
+
+    namespace util {
+
+        zerocopy_sender::zerocopy_sender(int fd, completion_callback cb)
+            : fd_(fd), cb_(cb)
+        {
+            int one = 1;
+            posix::setsockopt(fd_, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof one);
+        }
+
+        size_t zerocopy_sender::send(const void *p, size_t n, uint64_t tag,
+                int flags)
+        {
+            for (;;) {
+                ssize_t r = ::send(fd_, p, n, flags | MSG_ZEROCOPY);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS)
+                        return 0;
+                    throw send_error(errno);
+                }
+                // the kernel only numbers sends that queued data
+                if (r > 0) {
+                    entry e = { tag, false };
+                    window_.push_back(e);
+                    ++pending_;
+                }
+                return r;
+            }
+        }
+
+        size_t zerocopy_sender::pending() const
+        {
+            return pending_;
+        }
+
+        void zerocopy_sender::complete(uint32_t lo, uint32_t hi, bool copied)
+        {
+            // i.e. inclusive range, the kernel merges consecutive notifications
+            for (uint32_t id = lo; ; ++id) {
+                uint32_t i = id - base_;
+                if (i < window_.size() && !window_[i].done) {
+                    window_[i].done = true;
+                    --pending_;
+                    if (copied)
+                        ++copied_;
+                    if (cb_)
+                        cb_(window_[i].tag, copied);
+                }
+                if (id == hi)
+                    break;
+            }
+            while (!window_.empty() && window_.front().done) {
+                window_.pop_front();
+                ++base_;
+            }
+        }
+
+        size_t zerocopy_sender::process_completions()
+        {
+            size_t n = pending_;
+            for (;;) {
+                union {
+                    char buf[CMSG_SPACE(sizeof(struct sock_extended_err)
+                            + sizeof(struct sockaddr_in6))];
+                    struct cmsghdr align;
+                } control;
+                struct msghdr h = msghdr();
+                h.msg_control    = control.buf;
+                h.msg_controllen = sizeof control.buf;
+                ssize_t r = ::recvmsg(fd_, &h, MSG_ERRQUEUE);
+                if (r == -1) {
+                    if (errno == EINTR)
+                        continue;
+                    if (errno == EAGAIN || errno == EWOULDBLOCK)
+                        break;
+                    throw recvmsg_error(errno);
+                }
+                for (struct cmsghdr *c = CMSG_FIRSTHDR(&h); c;
+                        c = CMSG_NXTHDR(&h, c)) {
+                    if (!((c->cmsg_level == SOL_IP && c->cmsg_type == IP_RECVERR)
+                            || (c->cmsg_level == SOL_IPV6
+                                && c->cmsg_type == IPV6_RECVERR)))
+                        continue;
+                    struct sock_extended_err e;
+                    memcpy(&e, CMSG_DATA(c), sizeof e);
+                    if (e.ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                        continue;
+                    if (e.ee_errno)
+                        throw send_error(e.ee_errno, "zerocopy notification");
+                    complete(e.ee_info, e.ee_data,
+                            e.ee_code & SO_EE_CODE_ZEROCOPY_COPIED);
+                }
+            }
+            return n - pending_;
+        }
+
+    }
+
+}
+
+#endif // __linux__
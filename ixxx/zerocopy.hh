@@ -0,0 +1,87 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_ZEROCOPY_HH
+#define IXXX_ZEROCOPY_HH
+
+#include <deque>
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+namespace ixxx {
+
+    namespace util {
+
+#if defined(__linux__)
+
+        // Sends with MSG_ZEROCOPY (Linux >= 4.14), i.e. the kernel pins
+        // the user pages instead of copying them into the socket buffer.
+        //
+        // Thus, a buffer must not be modified until its completion
+        // notification arrived on the socket's error queue. Those are
+        // read by process_completions() which then calls the completion
+        // callback with the tag that was passed to send(). The copied
+        // flag signals that the kernel fell back to copying (e.g. on
+        // loopback), in which case MSG_ZEROCOPY just adds overhead.
+        //
+        // The error queue signals EPOLLERR (which epoll always reports),
+        // i.e. call process_completions() when epoll_wait() returns
+        // EPOLLERR for the socket.
+        //
+        // Each successful send() is numbered by the kernel and
+        // notifications cover ranges of those numbers, thus pending
+        // sends are tracked in a sequence-indexed window.
+        class zerocopy_sender {
+            public:
+                typedef std::function<void(uint64_t tag, bool copied)>
+                    completion_callback;
+
+                // enables SO_ZEROCOPY on fd
+                zerocopy_sender(int fd, completion_callback cb);
+                zerocopy_sender(const zerocopy_sender &) = delete;
+                zerocopy_sender &operator=(const zerocopy_sender &) = delete;
+
+                int fd() const { return fd_; }
+
+                // Returns the number of bytes sent, i.e. possibly less than
+                // n. Returns 0 if the socket buffer is full (EAGAIN) or the
+                // notification memory is exhausted (ENOBUFS), i.e. process
+                // completions and retry.
+                // The buffer (also when partially sent) is reusable
+                // once the callback was called with tag.
+                size_t send(const void *p, size_t n, uint64_t tag, int flags = 0);
+
+                // Reads all pending notifications from the error queue,
+                // returns the number of completed sends.
+                size_t process_completions();
+
+                // number of sends whose completion is outstanding
+                size_t pending() const;
+                // number of completions where the kernel copied anyway
+                size_t copied() const { return copied_; }
+            private:
+                struct entry {
+                    uint64_t tag;
+                    bool done;
+                };
+                void complete(uint32_t lo, uint32_t hi, bool copied);
+
+                int fd_;
+                completion_callback cb_;
+                // kernel sequence number of window_.front()
+                uint32_t base_ {0};
+                std::deque<entry> window_;
+                size_t pending_ {0};
+                size_t copied_ {0};
+        };
+
+#endif
+
+    }
+
+}
+
+#endif // IXXX_ZEROCOPY_HH
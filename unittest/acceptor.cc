@@ -0,0 +1,101 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/acceptor.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/socket.hh>
+
+#include "loopback.hh"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+#include <stdexcept>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( acceptor )
+
+    BOOST_AUTO_TEST_CASE( drain )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd lfd(bind_loopback(SOCK_STREAM, addr));
+      util::acceptor a(lfd.get());
+      BOOST_CHECK(posix::fcntl(lfd.get(), F_GETFL, 0) & O_NONBLOCK);
+
+      vector<util::unique_fd> clients, conns;
+      BOOST_CHECK_EQUAL(a.drain([&conns](util::unique_fd fd, const struct sockaddr_storage &,
+              socklen_t) { conns.push_back(std::move(fd)); }), 0u);
+
+      util::unique_fd epfd(linux::epoll_create1(EPOLL_CLOEXEC));
+      a.attach(epfd.get(), 42);
+      for (unsigned i = 0; i < 5; ++i)
+        clients.emplace_back(connect_to(SOCK_STREAM, addr));
+
+      struct epoll_event ev;
+      BOOST_CHECK_EQUAL(linux::epoll_wait(epfd.get(), &ev, 1, 1000), 1);
+      BOOST_CHECK_EQUAL(ev.data.u64, 42u);
+
+      size_t n = a.drain([&conns](util::unique_fd fd, const struct sockaddr_storage &addr,
+              socklen_t len) {
+          BOOST_CHECK_EQUAL(addr.ss_family, AF_INET);
+          BOOST_CHECK_EQUAL(len, sizeof(struct sockaddr_in));
+          conns.push_back(std::move(fd));
+          }, 3);
+      BOOST_CHECK_EQUAL(n, 3u);
+      n = a.drain([&conns](util::unique_fd fd, const struct sockaddr_storage &,
+              socklen_t) { conns.push_back(std::move(fd)); });
+      BOOST_CHECK_EQUAL(n, 2u);
+      BOOST_CHECK_EQUAL(conns.size(), 5u);
+      for (auto &c : conns) {
+        BOOST_CHECK(posix::fcntl(c.get(), F_GETFL, 0) & O_NONBLOCK);
+        BOOST_CHECK(posix::fcntl(c.get(), F_GETFD, 0) & FD_CLOEXEC);
+      }
+      BOOST_CHECK_EQUAL(linux::epoll_wait(epfd.get(), &ev, 1, 0), 0);
+      a.detach(epfd.get());
+    }
+
+    BOOST_AUTO_TEST_CASE( callback_throws )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd lfd(bind_loopback(SOCK_STREAM, addr));
+      util::acceptor a(lfd.get());
+      util::unique_fd client(connect_to(SOCK_STREAM, addr));
+      BOOST_CHECK_THROW(a.drain([](util::unique_fd, const struct sockaddr_storage &,
+              socklen_t) { throw runtime_error("fail"); }), runtime_error);
+      // the accepted connection was closed, i.e. the client sees EOF
+      struct pollfd p = { client.get(), POLLIN, 0 };
+      BOOST_CHECK_EQUAL(posix::poll(&p, 1, 1000), 1);
+      char c;
+      BOOST_CHECK_EQUAL(posix::read(client.get(), &c, 1), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE( not_stream )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd fd(bind_loopback(SOCK_DGRAM, addr));
+      util::acceptor a(fd.get());
+      BOOST_CHECK_EXCEPTION(a.drain([](util::unique_fd,
+              const struct sockaddr_storage &, socklen_t) {}), accept4_error,
+          [](const sys_error &e) { return e.code() == EOPNOTSUPP; });
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // acceptor
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
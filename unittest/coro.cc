@@ -0,0 +1,169 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/coro.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/reactor.hh>
+#include <ixxx/socket.hh>
+#include <ixxx/timer_wheel.hh>
+
+#include "loopback.hh"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+#include <chrono>
+#include <string>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__) && defined(__cpp_impl_coroutine)
+  BOOST_AUTO_TEST_SUITE( coro )
+
+    static util::coro::task<size_t> echo_server(util::reactor &r, int lfd)
+    {
+      util::coro::async_fd l(r, lfd);
+      util::unique_fd c(co_await util::coro::async_accept(l));
+      util::coro::async_fd f(r, c.get());
+      char buf[64];
+      size_t total = 0;
+      for (;;) {
+        size_t n = co_await util::coro::async_read(f, buf, sizeof buf);
+        if (!n)
+          break;
+        co_await util::coro::async_write(f, buf, n);
+        total += n;
+      }
+      co_return total;
+    }
+
+    static util::coro::task<std::string> echo_client(util::reactor &r,
+        const sockaddr_in &addr, std::string msg)
+    {
+      util::unique_fd c(posix::socket(AF_INET,
+            SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+      util::coro::async_fd f(r, c.get());
+      co_await util::coro::async_connect(f,
+          reinterpret_cast<const sockaddr*>(&addr), sizeof addr);
+      co_await util::coro::async_write(f, msg.data(), msg.size());
+      posix::shutdown(c.get(), SHUT_WR);
+      std::string s;
+      char buf[7];
+      for (;;) {
+        size_t n = co_await util::coro::async_read(f, buf, sizeof buf);
+        if (!n)
+          break;
+        s.append(buf, n);
+      }
+      co_return s;
+    }
+
+    BOOST_AUTO_TEST_CASE( echo )
+    {
+      sockaddr_in addr;
+      util::unique_fd l(bind_loopback(SOCK_STREAM | SOCK_NONBLOCK, addr));
+      posix::listen(l.get(), 16);
+      util::reactor r;
+      const std::string msg(1000, 'x');
+      size_t cached = 0;
+      for (int i = 0; i < 3; ++i) {
+        auto s = echo_server(r, l.get());
+        auto c = echo_client(r, addr, msg + std::to_string(i));
+        s.start();
+        c.start();
+        for (unsigned k = 0; k < 1000 && !(s.done() && c.done()); ++k)
+          r.run_once(100);
+        BOOST_REQUIRE(s.done());
+        BOOST_REQUIRE(c.done());
+        BOOST_CHECK_EQUAL(s.get(), msg.size() + 1);
+        BOOST_CHECK_EQUAL(c.get(), msg + std::to_string(i));
+        if (!i)
+          cached = util::coro::frame_pool::local().cached();
+        else // frames are recycled
+          BOOST_CHECK_EQUAL(util::coro::frame_pool::local().cached(), cached);
+      }
+      BOOST_CHECK(cached > 0);
+      BOOST_CHECK_EQUAL(r.size(), 0u);
+    }
+
+    static util::coro::task<void> connect_only(util::reactor &r,
+        const sockaddr_in &addr)
+    {
+      util::unique_fd c(posix::socket(AF_INET,
+            SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0));
+      util::coro::async_fd f(r, c.get());
+      co_await util::coro::async_connect(f,
+          reinterpret_cast<const sockaddr*>(&addr), sizeof addr);
+    }
+
+    BOOST_AUTO_TEST_CASE( refused )
+    {
+      sockaddr_in addr;
+      {
+        // a port that is very likely unused afterwards
+        util::unique_fd l(bind_loopback(SOCK_STREAM, addr));
+      }
+      util::reactor r;
+      auto t = connect_only(r, addr);
+      t.start();
+      for (unsigned k = 0; k < 100 && !t.done(); ++k)
+        r.run_once(100);
+      BOOST_REQUIRE(t.done());
+      BOOST_CHECK_EXCEPTION(t.get(), connect_error, [](const connect_error &e) {
+          return e.code() == ECONNREFUSED; });
+    }
+
+    static util::coro::task<int> sleeper(util::timer_wheel &w, int &stage)
+    {
+      stage = 1;
+      co_await util::coro::sleep_for(w, std::chrono::milliseconds(5));
+      stage = 2;
+      co_await util::coro::sleep_for(w, std::chrono::milliseconds(0));
+      co_return 42;
+    }
+
+    BOOST_AUTO_TEST_CASE( sleep )
+    {
+      util::reactor r;
+      util::timer_wheel w;
+      r.add(w.fd(), EPOLLIN, [&w](int, uint32_t) { w.process(); });
+      int stage = 0;
+      auto t = sleeper(w, stage);
+      BOOST_CHECK_EQUAL(stage, 0);
+      auto start = std::chrono::steady_clock::now();
+      t.start();
+      BOOST_CHECK_EQUAL(stage, 1);
+      BOOST_CHECK_EQUAL(w.size(), 1u);
+      for (unsigned k = 0; k < 100 && !t.done(); ++k)
+        r.run_once(100);
+      BOOST_REQUIRE(t.done());
+      BOOST_CHECK(std::chrono::steady_clock::now() - start
+          >= std::chrono::milliseconds(5));
+      BOOST_CHECK_EQUAL(t.get(), 42);
+
+      // destroying a sleeping coroutine cancels its timer
+      {
+        auto u = sleeper(w, stage);
+        u.start();
+        BOOST_CHECK_EQUAL(w.size(), 1u);
+      }
+      BOOST_CHECK_EQUAL(w.size(), 0u);
+      r.remove(w.fd());
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // coro
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,88 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/deadline.hh>
+#include <ixxx/fd.hh>
+
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( deadline )
+
+    BOOST_AUTO_TEST_CASE( remaining )
+    {
+      util::deadline d(std::chrono::seconds(10));
+      BOOST_CHECK(!d.expired());
+      BOOST_CHECK(d.remaining() <= std::chrono::seconds(10));
+      BOOST_CHECK(d.remaining() > std::chrono::seconds(9));
+      struct timespec ts = d.remaining_timespec();
+      BOOST_CHECK(ts.tv_sec == 9 || ts.tv_sec == 10);
+      d.advance(std::chrono::seconds(-20));
+      BOOST_CHECK(d.expired());
+      BOOST_CHECK_EQUAL(d.remaining().count(), 0);
+      auto e = util::deadline::at(util::deadline::now_ns() - 1);
+      BOOST_CHECK(e.expired());
+    }
+
+    BOOST_AUTO_TEST_CASE( sub_millisecond )
+    {
+      for (int i = 0; i < 3; ++i) {
+        int64_t start = util::deadline::now_ns();
+        util::deadline d(std::chrono::microseconds(300));
+        BOOST_CHECK_EQUAL(util::wait_until(d, nullptr, 0), 0);
+        BOOST_CHECK(d.expired());
+        BOOST_CHECK_GE(util::deadline::now_ns() - start, 300000);
+      }
+      util::unique_fd epfd(linux::epoll_create1(EPOLL_CLOEXEC));
+      struct epoll_event ev;
+      int64_t start = util::deadline::now_ns();
+      util::deadline d(std::chrono::microseconds(200));
+      BOOST_CHECK_EQUAL(util::wait_until(d, epfd.get(), &ev, 1), 0);
+      BOOST_CHECK_GE(util::deadline::now_ns() - start, 200000);
+    }
+
+    BOOST_AUTO_TEST_CASE( ready )
+    {
+      util::unique_fd efd(linux::eventfd(1, EFD_CLOEXEC));
+      struct pollfd p = { efd.get(), POLLIN, 0 };
+      util::deadline d(std::chrono::seconds(5));
+      BOOST_CHECK_EQUAL(util::wait_until(d, &p, 1), 1);
+      BOOST_CHECK(p.revents & POLLIN);
+
+      util::unique_fd epfd(linux::epoll_create1(EPOLL_CLOEXEC));
+      struct epoll_event ev = { 0 };
+      ev.events = EPOLLIN;
+      linux::epoll_ctl(epfd.get(), EPOLL_CTL_ADD, efd.get(), &ev);
+      BOOST_CHECK_EQUAL(util::wait_until(d, epfd.get(), &ev, 1), 1);
+      BOOST_CHECK(!d.expired());
+
+      struct timespec ts = { 0, 0 };
+      BOOST_CHECK_EQUAL(linux::ppoll(&p, 1, &ts, nullptr), 1);
+      // not an epoll descriptor
+      BOOST_CHECK_THROW(linux::epoll_pwait2(efd.get(), &ev, 1, &ts, nullptr),
+          epoll_pwait2_error);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // deadline
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
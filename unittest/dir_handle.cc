@@ -0,0 +1,97 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+namespace fs = boost::filesystem;
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/dir_handle.hh>
+#include <ixxx/fd.hh>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( dir_handle )
+
+    static void mk_tree()
+    {
+      fs::remove_all("tmp/dirh");
+      fs::create_directories("tmp/dirh/a/b/c");
+      fs::create_directories("tmp/dirh/x/y");
+      fs::create_directories("tmp/dirh/z");
+      for (auto f : { "tmp/dirh/a/b/c/file", "tmp/dirh/x/y/file",
+          "tmp/dirh/z/file" }) {
+        ofstream o(f);
+        o << "hello";
+      }
+      fs::create_symlink("b", "tmp/dirh/a/link");
+    }
+
+    BOOST_AUTO_TEST_CASE( open_cached )
+    {
+      mk_tree();
+      util::dir_handle h("tmp/dirh", 2);
+      {
+        util::unique_fd fd(h.open("a/b/c/file", O_RDONLY));
+        char buf[8] = {0};
+        BOOST_CHECK_EQUAL(posix::read(fd.get(), buf, sizeof buf), 5);
+        BOOST_CHECK_EQUAL(buf, "hello");
+      }
+      BOOST_CHECK_EQUAL(h.cached(), 1u);
+      h.open("a/b/c/file", O_RDONLY);
+      BOOST_CHECK_EQUAL(h.cached(), 1u);
+      h.open("x/y/file", O_RDONLY);
+      h.open("z/file", O_RDONLY);
+      BOOST_CHECK_EQUAL(h.cached(), 2u);
+      h.open(string("a/b/c/file"), O_RDONLY);
+      BOOST_CHECK_EQUAL(h.cached(), 2u);
+      util::unique_fd fd(h.open("z/new", O_CREAT | O_WRONLY, 0644));
+      BOOST_CHECK(fs::exists("tmp/dirh/z/new"));
+    }
+
+    BOOST_AUTO_TEST_CASE( beneath )
+    {
+      mk_tree();
+      util::dir_handle h("tmp/dirh");
+      BOOST_CHECK_THROW(h.open("../dirh/z/file", O_RDONLY), sys_error);
+      BOOST_CHECK_THROW(h.open("a/../../dirh/z/file", O_RDONLY), sys_error);
+      BOOST_CHECK_EXCEPTION(h.open("/etc/passwd", O_RDONLY), sys_error,
+          [](const sys_error &e) { return e.code() == EXDEV; });
+      BOOST_CHECK_EXCEPTION(h.open("/z/file", O_RDONLY), sys_error,
+          [](const sys_error &e) { return e.code() == EXDEV; });
+      BOOST_CHECK_THROW(h.open("a/link/c/file", O_RDONLY), sys_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( invalidate_on_enoent )
+    {
+      mk_tree();
+      util::dir_handle h("tmp/dirh");
+      h.open("a/b/c/file", O_RDONLY);
+      fs::rename("tmp/dirh/a/b/c", "tmp/dirh/a/b/c2");
+      fs::create_directories("tmp/dirh/a/b/c");
+      {
+        ofstream o("tmp/dirh/a/b/c/other");
+      }
+      util::unique_fd fd(h.open("a/b/c/other", O_RDONLY));
+      BOOST_CHECK(bool(fd));
+      BOOST_CHECK_EQUAL(h.cached(), 1u);
+      BOOST_CHECK_EXCEPTION(h.open("a/b/c/file", O_RDONLY), sys_error,
+          [](const sys_error &e) { return e.code() == ENOENT; });
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // dir_handle
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
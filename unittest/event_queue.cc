@@ -0,0 +1,108 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/event_queue.hh>
+#include <ixxx/fd.hh>
+
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+#include <chrono>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( event_queue )
+
+    BOOST_AUTO_TEST_CASE( basic )
+    {
+      util::event_queue<int> q(4);
+      BOOST_CHECK_EQUAL(q.capacity(), 4u);
+      for (int i = 0; i < 4; ++i)
+        BOOST_CHECK(q.try_push(i));
+      BOOST_CHECK(!q.try_push(4));
+      // no consumer is sleeping, thus no wakeups
+      BOOST_CHECK_EQUAL(q.wakeups(), 0u);
+      BOOST_CHECK(!q.prepare_wait());
+      q.finish_wait();
+      int sum = 0;
+      BOOST_CHECK_EQUAL(q.drain([&](int x) { sum += x; }), 4u);
+      BOOST_CHECK_EQUAL(sum, 6);
+
+      BOOST_CHECK(q.prepare_wait());
+      struct pollfd p = { q.fd(), POLLIN, 0 };
+      BOOST_CHECK_EQUAL(posix::poll(&p, 1, 0), 0);
+      q.try_push(42);
+      q.try_push(43);
+      BOOST_CHECK_EQUAL(posix::poll(&p, 1, 0), 1);
+      BOOST_CHECK_EQUAL(q.wakeups(), 1u);
+      q.finish_wait();
+      BOOST_CHECK_EQUAL(posix::poll(&p, 1, 0), 0);
+      int x = 0;
+      BOOST_CHECK(q.try_pop(x));
+      BOOST_CHECK_EQUAL(x, 42);
+    }
+
+    BOOST_AUTO_TEST_CASE( producers )
+    {
+      util::event_queue<uint64_t> q(1024);
+      util::unique_fd epfd(linux::epoll_create1(0));
+      struct epoll_event ev = { 0 };
+      ev.events = EPOLLIN;
+      linux::epoll_ctl(epfd.get(), EPOLL_CTL_ADD, q.fd(), &ev);
+
+      const unsigned threads = 4;
+      const uint64_t n = 100000;
+      vector<std::thread> ps;
+      for (unsigned t = 0; t < threads; ++t)
+        ps.emplace_back([&q, n] {
+            for (uint64_t i = 1; i <= n; ++i) {
+              while (!q.try_push(i))
+                std::this_thread::yield();
+            }
+          });
+      uint64_t sum = 0, k = 0;
+      while (k < threads * n) {
+        k += q.drain([&sum](uint64_t x) { sum += x; });
+        if (q.prepare_wait())
+          linux::epoll_wait(epfd.get(), &ev, 1, 1000);
+        q.finish_wait();
+      }
+      for (auto &t : ps)
+        t.join();
+      BOOST_CHECK_EQUAL(sum, threads * n * (n + 1) / 2);
+      BOOST_TEST_MESSAGE("wakeups: " << q.wakeups());
+      BOOST_CHECK_LE(q.wakeups(), k);
+    }
+
+    BOOST_AUTO_TEST_CASE( standalone_wait )
+    {
+      util::event_queue<int> q(8);
+      std::thread t([&q] {
+          std::this_thread::sleep_for(std::chrono::milliseconds(10));
+          q.try_push(7);
+        });
+      int x = 0;
+      for (unsigned i = 0; i < 100 && !q.try_pop(x); ++i)
+        q.wait(100);
+      t.join();
+      BOOST_CHECK_EQUAL(x, 7);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // event_queue
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
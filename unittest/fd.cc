@@ -0,0 +1,71 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+  BOOST_AUTO_TEST_SUITE( fd )
+
+    BOOST_AUTO_TEST_CASE( unique_fd_basic )
+    {
+      int x = -1;
+      {
+        util::unique_fd fd(posix::open("/dev/null", O_RDONLY));
+        BOOST_CHECK(bool(fd));
+        x = fd.get();
+        util::unique_fd g(std::move(fd));
+        BOOST_CHECK(!fd);
+        BOOST_CHECK_EQUAL(g.get(), x);
+        BOOST_CHECK_EQUAL(::fcntl(x, F_GETFD), 0);
+      }
+      BOOST_CHECK_EQUAL(::fcntl(x, F_GETFD), -1);
+      BOOST_CHECK_EQUAL(errno, EBADF);
+    }
+
+    BOOST_AUTO_TEST_CASE( unique_fd_release )
+    {
+      util::unique_fd fd(posix::open("/dev/null", O_RDONLY));
+      int x = fd.release();
+      BOOST_CHECK(!fd);
+      BOOST_CHECK_EQUAL(::fcntl(x, F_GETFD), 0);
+      fd.reset(x);
+      BOOST_CHECK_EQUAL(fd.get(), x);
+      fd.close();
+      BOOST_CHECK(!fd);
+      BOOST_CHECK_EQUAL(::fcntl(x, F_GETFD), -1);
+    }
+
+#if defined(__linux__)
+    BOOST_AUTO_TEST_CASE( close_from )
+    {
+      int fd = posix::open("/dev/null", O_RDONLY);
+      posix::dup2(fd, 1000);
+      posix::dup2(fd, 1001);
+      posix::close(fd);
+
+      util::close_from(1000, true);
+      BOOST_CHECK_EQUAL(::fcntl(1000, F_GETFD), FD_CLOEXEC);
+      BOOST_CHECK_EQUAL(::fcntl(1001, F_GETFD), FD_CLOEXEC);
+
+      util::close_from(1000);
+      BOOST_CHECK_EQUAL(::fcntl(1000, F_GETFD), -1);
+      BOOST_CHECK_EQUAL(::fcntl(1001, F_GETFD), -1);
+    }
+#endif
+
+  BOOST_AUTO_TEST_SUITE_END() // fd
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,69 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/histogram.hh>
+
+#include <stdint.h>
+#include <time.h>
+
+#include <algorithm>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+  BOOST_AUTO_TEST_SUITE( histogram )
+
+    BOOST_AUTO_TEST_CASE( buckets )
+    {
+      for (uint64_t v : { uint64_t(0), uint64_t(15), uint64_t(16), uint64_t(17),
+          uint64_t(1000), uint64_t(123456789), UINT64_MAX }) {
+        size_t i = util::latency_histogram::bucket(v);
+        BOOST_CHECK_LE(v, util::latency_histogram::bucket_max(i));
+        if (i)
+          BOOST_CHECK_GT(v, util::latency_histogram::bucket_max(i - 1));
+      }
+      BOOST_CHECK_EQUAL(util::latency_histogram::bucket_max(
+            util::latency_histogram::bucket(UINT64_MAX)), UINT64_MAX);
+    }
+
+    BOOST_AUTO_TEST_CASE( percentiles )
+    {
+      util::latency_histogram h;
+      BOOST_CHECK_EQUAL(h.percentile(50), 0u);
+      for (uint64_t i = 1; i <= 1000; ++i)
+        h.add(i * 1000);
+      BOOST_CHECK_EQUAL(h.count(), 1000u);
+      BOOST_CHECK_EQUAL(h.min(), 1000u);
+      BOOST_CHECK_EQUAL(h.max(), 1000000u);
+      BOOST_CHECK_CLOSE(h.mean(), 500500.0, 0.001);
+      uint64_t p50 = h.percentile(50);
+      BOOST_CHECK_GE(p50, 500000u);
+      BOOST_CHECK_LE(p50, 500000u + 500000u / 16);
+      uint64_t p99 = h.percentile(99);
+      BOOST_CHECK_GE(p99, 990000u);
+      BOOST_CHECK_LE(p99, 1000000u);
+      BOOST_CHECK_EQUAL(h.percentile(100), 1000000u);
+
+      util::latency_histogram g;
+      struct timespec a = { 1, 999999000 }, b = { 2, 1000 };
+      g.add(a, b);
+      g.add(b, a);
+      BOOST_CHECK_EQUAL(g.max(), 2000u);
+      BOOST_CHECK_EQUAL(g.min(), 0u);
+      h.merge(g);
+      BOOST_CHECK_EQUAL(h.count(), 1002u);
+      BOOST_CHECK_EQUAL(h.min(), 0u);
+      h.clear();
+      BOOST_CHECK_EQUAL(h.count(), 0u);
+      BOOST_CHECK_EQUAL(h.max(), 0u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // histogram
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,70 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+namespace fs = boost::filesystem;
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/inotify.hh>
+
+#include <stdint.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+#include <fstream>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( inotify )
+
+    BOOST_AUTO_TEST_CASE( epoll_events )
+    {
+      fs::remove_all("tmp/watch");
+      fs::create_directories("tmp/watch");
+      util::unique_fd epfd(linux::epoll_create1(EPOLL_CLOEXEC));
+      util::inotify_watcher w;
+      int wd = w.add("tmp/watch", IN_CREATE | IN_CLOSE_WRITE | IN_DELETE);
+      w.attach(epfd.get(), 23);
+
+      struct epoll_event ev;
+      BOOST_CHECK_EQUAL(linux::epoll_wait(epfd.get(), &ev, 1, 0), 0);
+      BOOST_CHECK_EQUAL(w.dispatch([](const struct inotify_event &) {}), 0u);
+
+      {
+        ofstream o("tmp/watch/foo");
+        o << "bar";
+      }
+      fs::remove("tmp/watch/foo");
+
+      BOOST_CHECK_EQUAL(linux::epoll_wait(epfd.get(), &ev, 1, 1000), 1);
+      BOOST_CHECK_EQUAL(ev.data.u64, 23u);
+      vector<uint32_t> masks;
+      size_t n = w.dispatch([&masks, wd](const struct inotify_event &e) {
+          BOOST_CHECK_EQUAL(e.wd, wd);
+          BOOST_CHECK_EQUAL(e.name, "foo");
+          masks.push_back(e.mask);
+          });
+      BOOST_CHECK_EQUAL(n, 3u);
+      BOOST_REQUIRE_EQUAL(masks.size(), 3u);
+      BOOST_CHECK_EQUAL(masks[0], uint32_t(IN_CREATE));
+      BOOST_CHECK_EQUAL(masks[1], uint32_t(IN_CLOSE_WRITE));
+      BOOST_CHECK_EQUAL(masks[2], uint32_t(IN_DELETE));
+      BOOST_CHECK_EQUAL(linux::epoll_wait(epfd.get(), &ev, 1, 0), 0);
+
+      w.remove(wd);
+      w.detach(epfd.get());
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // inotify
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
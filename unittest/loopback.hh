@@ -0,0 +1,39 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#ifndef IXXX_UNITTEST_LOOPBACK_HH
+#define IXXX_UNITTEST_LOOPBACK_HH
+
+#include <ixxx/socket.hh>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+// binds to an ephemeral port on 127.0.0.1
+inline int bind_loopback(int type, struct sockaddr_in &addr)
+{
+    int fd = ixxx::posix::socket(AF_INET, type, 0);
+    addr = sockaddr_in();
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ixxx::posix::bind(fd, reinterpret_cast<struct sockaddr*>(&addr),
+            sizeof addr);
+    socklen_t len = sizeof addr;
+    ixxx::posix::getsockname(fd, reinterpret_cast<struct sockaddr*>(&addr),
+            &len);
+    if (type == SOCK_STREAM)
+        ixxx::posix::listen(fd, 128);
+    return fd;
+}
+
+inline int connect_to(int type, const struct sockaddr_in &addr)
+{
+    int fd = ixxx::posix::socket(AF_INET, type, 0);
+    ixxx::posix::connect(fd, reinterpret_cast<const struct sockaddr*>(&addr),
+            sizeof addr);
+    return fd;
+}
+
+#endif // IXXX_UNITTEST_LOOPBACK_HH
@@ -0,0 +1,86 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/mmsg.hh>
+#include <ixxx/socket.hh>
+
+#include "loopback.hh"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include <algorithm>
+#include <string>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( mmsg )
+
+    BOOST_AUTO_TEST_CASE( udp_batch )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::unique_fd sfd(posix::socket(AF_INET, SOCK_DGRAM, 0));
+
+      util::mmsg_batch out(64, 128);
+      for (unsigned i = 0; i < 64; ++i) {
+        string s("msg" + to_string(i));
+        BOOST_CHECK(out.push(s.data(), s.size(),
+              reinterpret_cast<const struct sockaddr*>(&addr), sizeof addr));
+      }
+      BOOST_CHECK(!out.push("x", 1));
+      BOOST_CHECK_EQUAL(out.size(), 64u);
+      BOOST_CHECK_EQUAL(out.send(sfd.get()), 64u);
+      BOOST_CHECK_EQUAL(out.size(), 0u);
+
+      util::mmsg_batch in(16, 4);
+      unsigned k = 0;
+      for (unsigned i = 0; i < 4; ++i) {
+        size_t n = in.recv(rfd.get(), MSG_DONTWAIT);
+        BOOST_CHECK_EQUAL(n, 16u);
+        for (size_t j = 0; j < n; ++j, ++k) {
+          string s("msg" + to_string(k));
+          BOOST_CHECK_EQUAL(in.length(j), min(s.size(), size_t(4)));
+          BOOST_CHECK_EQUAL(in.truncated(j), s.size() > 4);
+          BOOST_CHECK_EQUAL(string(in.data(j), 4), s.substr(0, 4));
+          BOOST_CHECK_EQUAL(in.addr(j).ss_family, AF_INET);
+          BOOST_CHECK_EQUAL(in.addrlen(j), sizeof(struct sockaddr_in));
+        }
+      }
+      BOOST_CHECK_EQUAL(in.recv(rfd.get(), MSG_DONTWAIT), 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE( prepare_connected )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::unique_fd sfd(connect_to(SOCK_DGRAM, addr));
+
+      util::mmsg_batch out(2, 16);
+      strcpy(out.prepare(), "hello");
+      out.commit(5);
+      strcpy(out.prepare(), "world");
+      out.commit(5);
+      BOOST_CHECK(!out.prepare());
+      BOOST_CHECK_EQUAL(out.send(sfd.get()), 2u);
+
+      util::mmsg_batch in(4, 16);
+      // loopback delivers synchronously
+      BOOST_REQUIRE_EQUAL(in.recv(rfd.get(), MSG_WAITFORONE), 2u);
+      BOOST_CHECK_EQUAL(string(in.data(0), in.length(0)), "hello");
+      BOOST_CHECK_EQUAL(string(in.data(1), in.length(1)), "world");
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // mmsg
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,81 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/packet_ring.hh>
+#include <ixxx/socket.hh>
+
+#include "loopback.hh"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( packet_ring )
+
+    BOOST_AUTO_TEST_CASE( loopback )
+    {
+      std::unique_ptr<util::packet_ring> ring;
+      try {
+        ring.reset(new util::packet_ring("lo", 64 * 1024, 4));
+      } catch (const socket_error &e) {
+        if (e.code() != EPERM && e.code() != EACCES)
+          throw;
+        BOOST_TEST_MESSAGE("skipping: CAP_NET_RAW required");
+        return;
+      }
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::unique_fd sfd(connect_to(SOCK_DGRAM, addr));
+      const string marker("ixxx-packet-ring-");
+      const unsigned n = 5;
+      for (unsigned i = 0; i < n; ++i) {
+        string s(marker + char('0' + i));
+        posix::send(sfd.get(), s.data(), s.size(), 0);
+      }
+
+      // on loopback each frame is captured twice (outgoing/incoming)
+      unsigned seen[n] = { 0 };
+      unsigned k = 0;
+      for (unsigned i = 0; i < 100 && k < 2 * n; ++i) {
+        if (!ring->wait(100))
+          continue;
+        ring->dispatch([&](const util::packet &p) {
+            BOOST_CHECK_LE(p.length, p.wire_length);
+            BOOST_CHECK(p.ts.tv_sec);
+            string s(reinterpret_cast<const char*>(p.data), p.length);
+            size_t pos = s.find(marker);
+            if (pos == string::npos || pos + marker.size() >= s.size())
+              return;
+            unsigned j = s[pos + marker.size()] - '0';
+            if (j < n) {
+              ++seen[j];
+              ++k;
+            }
+          });
+      }
+      for (unsigned i = 0; i < n; ++i)
+        BOOST_CHECK_GE(seen[i], 1u);
+      util::packet_ring::stats st = ring->statistics();
+      BOOST_CHECK_GE(st.packets, k);
+      BOOST_CHECK_EQUAL(st.drops, 0u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // packet_ring
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,168 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/reactor.hh>
+
+#include <errno.h>
+#include <signal.h>
+#include <stdint.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+#include <memory>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( reactor )
+
+    struct pipe_pair {
+      pipe_pair()
+      {
+        int p[2];
+        posix::pipe(p);
+        r.reset(p[0]);
+        w.reset(p[1]);
+      }
+      util::unique_fd r;
+      util::unique_fd w;
+    };
+
+    BOOST_AUTO_TEST_CASE( oneshot_rearm )
+    {
+      util::reactor re;
+      pipe_pair p;
+      unsigned calls = 0;
+      re.add(p.r.get(), EPOLLIN | EPOLLET | EPOLLONESHOT,
+          [&](int fd, uint32_t events) {
+            BOOST_CHECK_EQUAL(fd, p.r.get());
+            BOOST_CHECK(events & EPOLLIN);
+            char buf[16];
+            posix::read(fd, buf, sizeof buf);
+            ++calls;
+          });
+      BOOST_CHECK_EQUAL(re.size(), 1u);
+      BOOST_CHECK_EQUAL(re.run_once(0), 0u);
+      posix::write(p.w.get(), "x", 1);
+      BOOST_CHECK_EQUAL(re.run_once(0), 1u);
+      BOOST_CHECK_EQUAL(calls, 1u);
+      posix::write(p.w.get(), "x", 1);
+      // disabled until rearmed
+      BOOST_CHECK_EQUAL(re.run_once(0), 0u);
+      re.rearm(p.r.get());
+      BOOST_CHECK_EQUAL(re.run_once(0), 1u);
+      BOOST_CHECK_EQUAL(calls, 2u);
+      BOOST_CHECK_THROW(re.add(p.r.get(), EPOLLIN, [](int, uint32_t) {}),
+          epoll_ctl_error);
+      re.remove(p.r.get());
+      BOOST_CHECK(!re.contains(p.r.get()));
+      BOOST_CHECK_THROW(re.rearm(p.r.get()), epoll_ctl_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( remove_during_dispatch )
+    {
+      util::reactor re;
+      pipe_pair a, b;
+      std::unique_ptr<pipe_pair> c(new pipe_pair());
+      unsigned calls_b = 0, calls_c = 0;
+      // whichever of a/b is dispatched first removes and closes the
+      // other one and c, and re-adds c's descriptor number with a
+      // different pipe
+      std::unique_ptr<pipe_pair> d;
+      auto kill = [&](int self, int other) {
+        if (re.contains(other)) {
+          re.remove(other);
+          int cfd = c->r.get();
+          re.remove(cfd);
+          c.reset();
+          d.reset(new pipe_pair());
+          // most likely gets the descriptor number of c's read end
+          re.add(d->r.get(), EPOLLIN, [&](int, uint32_t) { ++calls_c; });
+        }
+        // removing oneself is fine as well
+        re.remove(self);
+      };
+      re.add(a.r.get(), EPOLLIN, [&](int fd, uint32_t) { kill(fd, b.r.get()); });
+      re.add(b.r.get(), EPOLLIN, [&](int fd, uint32_t) {
+          ++calls_b;
+          kill(fd, a.r.get());
+        });
+      re.add(c->r.get(), EPOLLIN, [&](int, uint32_t) { ++calls_c; });
+      posix::write(a.w.get(), "x", 1);
+      posix::write(b.w.get(), "x", 1);
+      posix::write(c->w.get(), "x", 1);
+      BOOST_CHECK_EQUAL(re.run_once(0), 1u);
+      BOOST_CHECK_LE(calls_b, 1u);
+      BOOST_CHECK_EQUAL(calls_c, 0u);
+      BOOST_CHECK_EQUAL(re.size(), 1u);
+      // d's pipe is empty
+      BOOST_CHECK_EQUAL(re.run_once(0), 0u);
+      posix::write(d->w.get(), "x", 1);
+      BOOST_CHECK_EQUAL(re.run_once(0), 1u);
+      BOOST_CHECK_EQUAL(calls_c, 1u);
+    }
+
+    BOOST_AUTO_TEST_CASE( grow_events )
+    {
+      util::reactor re(4, 64);
+      vector<pipe_pair> ps(100);
+      unsigned calls = 0;
+      for (auto &p : ps) {
+        re.add(p.r.get(), EPOLLIN | EPOLLET, [&](int, uint32_t) { ++calls; });
+        posix::write(p.w.get(), "x", 1);
+      }
+      size_t n = 0;
+      for (unsigned i = 0; i < 10; ++i)
+        n += re.run_once(0);
+      BOOST_CHECK_EQUAL(n, 100u);
+      BOOST_CHECK_EQUAL(calls, 100u);
+      BOOST_CHECK_EQUAL(re.events_capacity(), 64u);
+    }
+
+    BOOST_AUTO_TEST_CASE( run_stop )
+    {
+      util::reactor re;
+      pipe_pair p;
+      re.add(p.r.get(), EPOLLIN, [&](int, uint32_t) { re.stop(); });
+      posix::write(p.w.get(), "x", 1);
+      re.run();
+      BOOST_CHECK_EQUAL(re.size(), 1u);
+    }
+
+    BOOST_AUTO_TEST_CASE( stop_before_run )
+    {
+      util::reactor re;
+      re.stop();
+      // would block forever otherwise
+      re.run();
+      BOOST_CHECK_EQUAL(re.run_once(0), 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE( remove_failure )
+    {
+      util::reactor re;
+      pipe_pair p;
+      int fd = p.r.get();
+      re.add(fd, EPOLLIN, [](int, uint32_t) {});
+      // closing implicitly removes it from the epoll set
+      p.r.reset();
+      BOOST_CHECK_THROW(re.remove(fd), epoll_ctl_error);
+      BOOST_CHECK(re.contains(fd));
+      BOOST_CHECK_EQUAL(re.size(), 1u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // reactor
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
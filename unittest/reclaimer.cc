@@ -0,0 +1,123 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/reclaimer.hh>
+
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if !defined(__MINGW32__) && !defined(__MINGW64__)
+  BOOST_AUTO_TEST_SUITE( reclaimer )
+
+    BOOST_AUTO_TEST_CASE( close_munmap )
+    {
+      util::reclaimer r(16);
+      vector<int> fds;
+      for (unsigned i = 0; i < 100; ++i) {
+        fds.push_back(posix::open("/dev/null", O_RDONLY));
+        r.close(fds.back());
+      }
+      size_t n = 64 * 1024 * 1024;
+      void *p = posix::mmap(nullptr, n, PROT_READ | PROT_WRITE,
+          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      memset(p, 23, n);
+      r.munmap(p, n);
+      r.flush();
+      BOOST_CHECK_EQUAL(r.completed(), 101u);
+      BOOST_CHECK_EQUAL(r.errors(), 0u);
+      for (int fd : fds)
+        BOOST_CHECK_EQUAL(::fcntl(fd, F_GETFD), -1);
+    }
+
+    BOOST_AUTO_TEST_CASE( error_callback )
+    {
+      int code = 0;
+      Function f = Function::OPEN;
+      {
+        util::reclaimer r(16, [&code, &f](const sys_error &e) {
+            code = e.code(); f = e.function(); });
+        r.close(-23);
+        r.flush();
+        BOOST_CHECK_EQUAL(r.errors(), 1u);
+      }
+      BOOST_CHECK_EQUAL(code, EBADF);
+      BOOST_CHECK(f == Function::CLOSE);
+    }
+
+    BOOST_AUTO_TEST_CASE( negative_fds )
+    {
+      vector<int> codes;
+      util::reclaimer r(16, [&codes](const sys_error &e) {
+          codes.push_back(e.code()); });
+      // i.e. not mistaken for internal requests
+      r.close(-1);
+      r.close(-2);
+      r.flush();
+      BOOST_CHECK_EQUAL(r.errors(), 2u);
+      BOOST_CHECK_EQUAL(r.completed(), 2u);
+      BOOST_CHECK((codes == vector<int>{EBADF, EBADF}));
+    }
+
+    BOOST_AUTO_TEST_CASE( destructor_drains )
+    {
+      vector<int> fds;
+      {
+        util::reclaimer r;
+        for (unsigned i = 0; i < 10; ++i) {
+          fds.push_back(posix::open("/dev/null", O_RDONLY));
+          r.close(fds.back());
+        }
+      }
+      for (int fd : fds)
+        BOOST_CHECK_EQUAL(::fcntl(fd, F_GETFD), -1);
+    }
+
+    BOOST_AUTO_TEST_CASE( concurrent_flush )
+    {
+      // each flush() must cover the caller's own requests, even if other
+      // threads enqueue concurrently
+      util::reclaimer r(64);
+      atomic<unsigned> failures(0);
+      vector<thread> ts;
+      for (unsigned k = 0; k < 4; ++k) {
+        ts.emplace_back([&r, &failures] {
+            for (unsigned i = 0; i < 200; ++i) {
+              int p[2];
+              posix::pipe(p);
+              posix::fcntl(p[0], F_SETFL, O_NONBLOCK);
+              r.close(p[1]);
+              r.flush();
+              char c;
+              // EOF iff the write end is closed
+              if (::read(p[0], &c, 1) != 0)
+                ++failures;
+              posix::close(p[0]);
+            }
+          });
+      }
+      for (auto &t : ts)
+        t.join();
+      BOOST_CHECK_EQUAL(failures.load(), 0u);
+      BOOST_CHECK_EQUAL(r.completed(), 800u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // reclaimer
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
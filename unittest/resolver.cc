@@ -0,0 +1,227 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/resolver.hh>
+#include <ixxx/socket.hh>
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <poll.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( resolver )
+
+    // processes completions until n callbacks were called
+    static void wait_for(util::resolver &r, size_t n)
+    {
+      size_t k = 0;
+      for (unsigned i = 0; i < 50 && k < n; ++i) {
+        struct pollfd p = { r.fd(), POLLIN, 0 };
+        if (posix::poll(&p, 1, 100) == 1)
+          k += r.process();
+      }
+      BOOST_REQUIRE_EQUAL(k, n);
+    }
+
+    static string ip_of(const util::endpoint &e)
+    {
+      const struct sockaddr_in &a =
+          reinterpret_cast<const struct sockaddr_in&>(e.addr);
+      char buf[INET_ADDRSTRLEN];
+      return inet_ntop(AF_INET, &a.sin_addr, buf, sizeof buf);
+    }
+
+    BOOST_AUTO_TEST_CASE( hosts )
+    {
+      util::resolver r;
+      vector<util::resolve_result> rs;
+      auto cb = [&rs](const util::resolve_result &x) { rs.push_back(x); };
+      r.resolve("localhost", "80", cb, AF_INET);
+      wait_for(r, 1);
+      BOOST_REQUIRE_EQUAL(rs.at(0).error, 0);
+      BOOST_REQUIRE(!rs[0].endpoints.empty());
+      BOOST_CHECK_EQUAL(ip_of(rs[0].endpoints[0]), "127.0.0.1");
+      BOOST_CHECK_EQUAL(ntohs(reinterpret_cast<const struct sockaddr_in&>(
+              rs[0].endpoints[0].addr).sin_port), 80);
+      BOOST_CHECK_EQUAL(r.misses(), 1u);
+
+      r.resolve("localhost", "80", cb, AF_INET);
+      BOOST_CHECK_EQUAL(r.pending(), 1u);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(r.pending(), 0u);
+      BOOST_CHECK_EQUAL(r.hits(), 1u);
+      BOOST_CHECK_EQUAL(rs.at(1).endpoints.size(), rs[0].endpoints.size());
+    }
+
+    BOOST_AUTO_TEST_CASE( negative )
+    {
+      util::resolver r;
+      int err = 0;
+      auto cb = [&err](const util::resolve_result &x) { err = x.error; };
+      r.resolve("not-a-number", "", cb, AF_UNSPEC, SOCK_STREAM, AI_NUMERICHOST);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(err, EAI_NONAME);
+      err = 0;
+      r.resolve("not-a-number", "", cb, AF_UNSPEC, SOCK_STREAM, AI_NUMERICHOST);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(err, EAI_NONAME);
+      BOOST_CHECK_EQUAL(r.hits(), 1u);
+    }
+
+    BOOST_AUTO_TEST_CASE( bounded )
+    {
+      util::resolver r(1, 2);
+      auto cb = [](const util::resolve_result &) {};
+      const char *hosts[] = { "127.0.0.1", "127.0.0.2", "127.0.0.3" };
+      for (auto h : hosts)
+        r.resolve(h, "", cb, AF_INET, SOCK_STREAM, AI_NUMERICHOST);
+      wait_for(r, 3);
+      BOOST_CHECK_EQUAL(r.cached(), 2u);
+      // the least recently used one was evicted
+      r.resolve("127.0.0.1", "", cb, AF_INET, SOCK_STREAM, AI_NUMERICHOST);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(r.hits(), 0u);
+      r.resolve("127.0.0.3", "", cb, AF_INET, SOCK_STREAM, AI_NUMERICHOST);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(r.hits(), 1u);
+    }
+
+    // Answers A queries with 127.0.0.42 and names starting
+    // with 'nx' with NXDOMAIN.
+    class stub_dns {
+      public:
+        explicit stub_dns(int fd) : fd_(fd), thread_(&stub_dns::run, this) {}
+        ~stub_dns() { stop_ = true; thread_.join(); }
+        unsigned queries(const string &name)
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          return queries_[name];
+        }
+      private:
+        void run()
+        {
+          while (!stop_) {
+            struct pollfd p = { fd_.get(), POLLIN, 0 };
+            if (posix::poll(&p, 1, 10) != 1)
+              continue;
+            unsigned char q[512];
+            struct sockaddr_storage peer;
+            socklen_t peerlen = sizeof peer;
+            ssize_t n = ::recvfrom(fd_.get(), q, sizeof q, 0,
+                reinterpret_cast<struct sockaddr*>(&peer), &peerlen);
+            if (n < 12)
+              continue;
+            string name;
+            size_t i = 12;
+            while (i < size_t(n) && q[i]) {
+              if (!name.empty())
+                name += '.';
+              name.append(reinterpret_cast<char*>(q) + i + 1, q[i]);
+              i += q[i] + 1;
+            }
+            if (i + 5 > size_t(n))
+              continue;
+            unsigned qtype = q[i + 1] << 8 | q[i + 2];
+            i += 5;
+            {
+              std::lock_guard<std::mutex> lock(mutex_);
+              ++queries_[name];
+            }
+            string a(reinterpret_cast<char*>(q), i);
+            a[2] = char(0x80 | (q[2] & 0x01)); // QR, RD
+            a[3] = char(0x80);                 // RA
+            a[6] = a[7] = a[8] = a[9] = a[10] = a[11] = 0;
+            if (!name.compare(0, 2, "nx")) {
+              a[3] |= 3;                       // NXDOMAIN
+            } else if (qtype == 1) {
+              a[7] = 1;
+              const unsigned char rr[] = { 0xc0, 0x0c, 0, 1, 0, 1,
+                0, 0, 0, 60, 0, 4, 127, 0, 0, 42 };
+              a.append(reinterpret_cast<const char*>(rr), sizeof rr);
+            }
+            ::sendto(fd_.get(), a.data(), a.size(), 0,
+                reinterpret_cast<struct sockaddr*>(&peer), peerlen);
+          }
+        }
+
+        util::unique_fd fd_;
+        std::atomic<bool> stop_ {false};
+        std::mutex mutex_;
+        std::map<string, unsigned> queries_;
+        std::thread thread_;
+    };
+
+    BOOST_AUTO_TEST_CASE( stub_server )
+    {
+      std::ifstream f("/etc/resolv.conf");
+      string conf((std::istreambuf_iterator<char>(f)),
+          std::istreambuf_iterator<char>());
+      if (conf.find("nameserver 127.0.0.1") == string::npos) {
+        BOOST_TEST_MESSAGE("skipping: resolver doesn't use 127.0.0.1");
+        return;
+      }
+      util::unique_fd fd(posix::socket(AF_INET, SOCK_DGRAM, 0));
+      struct sockaddr_in addr = sockaddr_in();
+      addr.sin_family      = AF_INET;
+      addr.sin_port        = htons(53);
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (::bind(fd.get(), reinterpret_cast<struct sockaddr*>(&addr),
+            sizeof addr) == -1) {
+        BOOST_TEST_MESSAGE("skipping: can't bind 127.0.0.1:53");
+        return;
+      }
+      stub_dns dns(fd.release());
+
+      util::resolver r;
+      vector<util::resolve_result> rs;
+      auto cb = [&rs](const util::resolve_result &x) { rs.push_back(x); };
+      r.resolve("stub.example", "", cb, AF_INET);
+      r.resolve("stub.example", "", cb, AF_INET);
+      wait_for(r, 2);
+      BOOST_REQUIRE_EQUAL(rs.at(0).error, 0);
+      BOOST_REQUIRE_EQUAL(rs[0].endpoints.size(), 1u);
+      BOOST_CHECK_EQUAL(ip_of(rs[0].endpoints[0]), "127.0.0.42");
+      BOOST_CHECK_EQUAL(rs.at(1).endpoints.size(), 1u);
+      unsigned n = dns.queries("stub.example");
+      // the concurrent lookups were coalesced
+      BOOST_CHECK_EQUAL(n, 1u);
+      r.resolve("stub.example", "", cb, AF_INET);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(dns.queries("stub.example"), n);
+
+      r.resolve("nx.example", "", cb, AF_INET);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(rs.at(3).error, EAI_NONAME);
+      n = dns.queries("nx.example");
+      BOOST_CHECK_GE(n, 1u);
+      r.resolve("nx.example", "", cb, AF_INET);
+      wait_for(r, 1);
+      BOOST_CHECK_EQUAL(rs.at(4).error, EAI_NONAME);
+      BOOST_CHECK_EQUAL(dns.queries("nx.example"), n);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // resolver
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
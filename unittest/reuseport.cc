@@ -0,0 +1,144 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/reuseport.hh>
+#include <ixxx/socket.hh>
+
+#include "loopback.hh"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( reuseport )
+
+    BOOST_AUTO_TEST_CASE( steer_by_cpu )
+    {
+      cpu_set_t old_set;
+      CPU_ZERO(&old_set);
+      BOOST_REQUIRE_EQUAL(sched_getaffinity(0, sizeof old_set, &old_set), 0);
+      int cpu = 0;
+      while (!CPU_ISSET(cpu, &old_set))
+        ++cpu;
+
+      struct sockaddr_in addr = sockaddr_in();
+      addr.sin_family      = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      util::reuseport_group g(reinterpret_cast<struct sockaddr*>(&addr),
+          sizeof addr, 2);
+      BOOST_REQUIRE_EQUAL(g.size(), 2u);
+      const struct sockaddr_in &bound =
+          reinterpret_cast<const struct sockaddr_in&>(g.addr());
+      BOOST_CHECK(bound.sin_port != 0);
+
+      // everything received on our CPU goes to listener 1, i.e. not
+      // where the modulo fallback or the default hash might put it
+      g.steer_by_cpu(vector<int>{ cpu + 1, cpu });
+
+      std::atomic<bool> stop(false);
+      std::atomic<unsigned> misplaced(0);
+      std::atomic<unsigned> accepted[2];
+      accepted[0] = 0;
+      accepted[1] = 0;
+      g.start_workers([&](unsigned i, int lfd) {
+          // Boost.Test assertions aren't thread-safe
+          cpu_set_t set;
+          CPU_ZERO(&set);
+          if (sched_getaffinity(0, sizeof set, &set) || CPU_COUNT(&set) != 1
+                  || !CPU_ISSET(cpu, &set))
+            ++misplaced;
+          while (!stop) {
+            struct pollfd p = { lfd, POLLIN, 0 };
+            if (posix::poll(&p, 1, 10) == 1) {
+              util::unique_fd cfd(posix::accept(lfd, nullptr, nullptr));
+              ++accepted[i];
+            }
+          }
+        }, vector<int>{ cpu, cpu });
+
+      // the SYN is processed on the connecting CPU
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(cpu, &set);
+      BOOST_REQUIRE_EQUAL(sched_setaffinity(0, sizeof set, &set), 0);
+      vector<util::unique_fd> clients;
+      for (unsigned i = 0; i < 4; ++i)
+        clients.emplace_back(connect_to(SOCK_STREAM, bound));
+      sched_setaffinity(0, sizeof old_set, &old_set);
+
+      for (unsigned i = 0; i < 200 && accepted[0] + accepted[1] < 4; ++i)
+        usleep(10 * 1000);
+      stop = true;
+      g.join();
+      BOOST_CHECK_EQUAL(misplaced, 0u);
+      BOOST_CHECK_EQUAL(accepted[0], 0u);
+      BOOST_CHECK_EQUAL(accepted[1], 4u);
+    }
+
+    BOOST_AUTO_TEST_CASE( worker_exception )
+    {
+      struct sockaddr_in addr = sockaddr_in();
+      addr.sin_family      = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      util::reuseport_group g(reinterpret_cast<struct sockaddr*>(&addr),
+          sizeof addr, 1);
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      BOOST_REQUIRE_EQUAL(sched_getaffinity(0, sizeof set, &set), 0);
+      int cpu = 0;
+      while (!CPU_ISSET(cpu, &set))
+        ++cpu;
+      g.start_workers([](unsigned, int) {
+          throw std::runtime_error("worker failed");
+        }, vector<int>{ cpu });
+      BOOST_CHECK_THROW(g.join(), std::runtime_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( bad_cpu )
+    {
+      struct sockaddr_in addr = sockaddr_in();
+      addr.sin_family      = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      util::reuseport_group g(reinterpret_cast<struct sockaddr*>(&addr),
+          sizeof addr, 2);
+      std::atomic<unsigned> started(0);
+      BOOST_CHECK_THROW(g.start_workers([&started](unsigned, int) {
+            ++started; }, vector<int>{ 0, CPU_SETSIZE }),
+          pthread_attr_setaffinity_np_error);
+      BOOST_CHECK_EQUAL(started, 0u);
+
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      BOOST_REQUIRE_EQUAL(sched_getaffinity(0, sizeof set, &set), 0);
+      int cpu = 0;
+      while (!CPU_ISSET(cpu, &set))
+        ++cpu;
+      // the second thread can't be created on a CPU that isn't online,
+      // the exception of the first one must not replace that error
+      BOOST_CHECK_THROW(g.start_workers([](unsigned, int) {
+            throw std::runtime_error("worker failed");
+          }, vector<int>{ cpu, CPU_SETSIZE - 1 }), pthread_create_error);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // reuseport
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,154 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/ring.hh>
+#include <ixxx/runtime.hh>
+
+#include <errno.h>
+#include <sched.h>
+#include <stdint.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( runtime )
+
+    template <typename F>
+    static bool wait_for(F f)
+    {
+      for (unsigned i = 0; i < 5000 && !f(); ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      return f();
+    }
+
+    BOOST_AUTO_TEST_CASE( spsc_ring )
+    {
+      util::spsc_ring<int> r(3);
+      BOOST_CHECK_EQUAL(r.capacity(), 4u);
+      BOOST_CHECK(r.empty());
+      for (int i = 0; i < 4; ++i)
+        BOOST_CHECK(r.try_push(i));
+      BOOST_CHECK(!r.try_push(4));
+      int x = -1;
+      BOOST_CHECK(r.try_pop(x));
+      BOOST_CHECK_EQUAL(x, 0);
+      BOOST_CHECK(r.try_push(4));
+      for (int i = 1; i < 5; ++i) {
+        BOOST_CHECK(r.try_pop(x));
+        BOOST_CHECK_EQUAL(x, i);
+      }
+      BOOST_CHECK(!r.try_pop(x));
+      BOOST_CHECK(r.empty());
+    }
+
+    struct ping {
+      std::atomic<unsigned> *done;
+      unsigned left;
+      void operator()(util::core &c)
+      {
+        if (!left) {
+          ++*done;
+          return;
+        }
+        ping p = { done, left - 1 };
+        unsigned to = (c.index() + 1) % c.owner().size();
+        while (!c.send(to, p))
+          ;
+      }
+    };
+
+    BOOST_AUTO_TEST_CASE( ping_pong )
+    {
+      util::runtime::config cfg;
+      // more cores than CPUs is fine, too
+      cfg.cpus = { 0, 0, 0 };
+      util::runtime rt(cfg);
+      BOOST_CHECK_EQUAL(rt.size(), 3u);
+      std::atomic<unsigned> done(0);
+      rt.launch();
+      const unsigned chains = 10, hops = 1000;
+      for (unsigned i = 0; i < chains; ++i)
+        BOOST_CHECK(rt.post(i % 3, ping{ &done, hops }));
+      BOOST_CHECK(wait_for([&done] { return done == chains; }));
+      rt.shutdown();
+      uint64_t tasks = 0, sent = 0;
+      for (unsigned i = 0; i < rt.size(); ++i) {
+        util::core::load_counters l = rt.load(i);
+        tasks += l.tasks;
+        sent += l.sent;
+        BOOST_CHECK_LE(l.doorbells, l.sent);
+      }
+      BOOST_CHECK_EQUAL(sent, chains * hops);
+      BOOST_CHECK_EQUAL(tasks, chains * (hops + 1));
+      BOOST_CHECK(!rt.post(0, ping{ &done, 0 }));
+    }
+
+    BOOST_AUTO_TEST_CASE( init_and_reactor )
+    {
+      util::runtime::config cfg;
+      util::runtime rt(cfg);
+      BOOST_REQUIRE(rt.size() > 0u);
+      util::unique_fd efd(linux::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+      std::atomic<unsigned> inits(0), events(0);
+      rt.launch([&](util::core &c) {
+          ++inits;
+          if (!c.index())
+            c.loop().add(efd.get(), EPOLLIN, [&events](int fd, uint32_t) {
+                uint64_t v;
+                posix::read(fd, &v, sizeof v);
+                ++events;
+              });
+        });
+      BOOST_CHECK_EQUAL(inits, rt.size());
+      uint64_t one = 1;
+      posix::write(efd.get(), &one, sizeof one);
+      BOOST_CHECK(wait_for([&events] { return events == 1; }));
+      rt.post(0, [&efd](util::core &c) { c.loop().remove(efd.get()); });
+      rt.shutdown();
+      BOOST_CHECK(rt.load(0).events >= 1u);
+    }
+
+    BOOST_AUTO_TEST_CASE( failure )
+    {
+      util::runtime::config cfg;
+      cfg.cpus = { 0, 0 };
+      util::runtime rt(cfg);
+      rt.launch();
+      rt.post(1, [](util::core &) { throw std::runtime_error("boom"); });
+      BOOST_CHECK(wait_for([&rt] { return rt.stopped(); }));
+      BOOST_CHECK_THROW(rt.shutdown(), std::runtime_error);
+      // the error is only reported once
+      rt.shutdown();
+    }
+
+    BOOST_AUTO_TEST_CASE( invalid_cpu )
+    {
+      util::runtime::config c;
+      c.cpus = { CPU_SETSIZE };
+      BOOST_CHECK_THROW(util::runtime rt(c), pthread_attr_setaffinity_np_error);
+      c.cpus = { -1 };
+      BOOST_CHECK_THROW(util::runtime rt(c), pthread_attr_setaffinity_np_error);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // runtime
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
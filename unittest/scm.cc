@@ -0,0 +1,122 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/scm.hh>
+#include <ixxx/socket.hh>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( scm )
+
+    BOOST_AUTO_TEST_CASE( rights_and_credentials )
+    {
+      int sv[2];
+      posix::socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, sv);
+      util::unique_fd a(sv[0]), b(sv[1]);
+      util::set_passcred(b.get());
+      int p[2];
+      posix::pipe(p);
+      util::unique_fd pr(p[0]), pw(p[1]);
+
+      int fds[1] = { pw.get() };
+      BOOST_CHECK_EQUAL(util::send_scm(a.get(), "x", 1, fds, 1, true), 1u);
+      char c = 0;
+      int in[2] = { -1, -1 };
+      size_t n = 2;
+      struct ucred cred;
+      BOOST_CHECK_EQUAL(util::recv_scm(b.get(), &c, 1, in, &n, &cred), 1u);
+      BOOST_CHECK_EQUAL(c, 'x');
+      BOOST_REQUIRE_EQUAL(n, 1u);
+      util::unique_fd w(in[0]);
+      BOOST_CHECK(posix::fcntl(w.get(), F_GETFD, 0) & FD_CLOEXEC);
+      BOOST_CHECK_EQUAL(cred.pid, getpid());
+      BOOST_CHECK_EQUAL(cred.uid, geteuid());
+      posix::write(w.get(), "y", 1);
+      posix::read(pr.get(), &c, 1);
+      BOOST_CHECK_EQUAL(c, 'y');
+    }
+
+    BOOST_AUTO_TEST_CASE( too_many_fds )
+    {
+      int sv[2];
+      posix::socketpair(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0, sv);
+      util::unique_fd a(sv[0]), b(sv[1]);
+      int fds[3] = { 0, 1, 2 };
+      util::send_scm(a.get(), "x", 1, fds, 3);
+      char c;
+      int in[1];
+      size_t n = 1;
+      BOOST_CHECK_THROW(util::recv_scm(b.get(), &c, 1, in, &n), recvmsg_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( seqpacket_batch )
+    {
+      util::unique_fd fa, fb;
+      util::seqpacket_channel::pair(fa, fb);
+      util::seqpacket_channel a(fa.release(), 8, 64, 2);
+      util::seqpacket_channel b(fb.release(), 8, 64, 2);
+      posix::fcntl(b.fd(), F_SETFL, posix::fcntl(b.fd(), F_GETFL, 0) | O_NONBLOCK);
+      BOOST_CHECK_EQUAL(b.recv(), 0u);
+
+      vector<util::unique_fd> readers;
+      vector<util::unique_fd> writers;
+      for (unsigned i = 0; i < 5; ++i) {
+        int p[2];
+        posix::pipe(p);
+        readers.emplace_back(p[0]);
+        writers.emplace_back(p[1]);
+        string s("msg" + std::to_string(i));
+        int fds[1] = { p[1] };
+        BOOST_CHECK(a.push(s.data(), s.size(), fds, i % 2 ? 0 : 1));
+      }
+      BOOST_CHECK_EQUAL(a.pending(), 5u);
+      BOOST_CHECK_EQUAL(a.flush(), 5u);
+      BOOST_CHECK_EQUAL(a.pending(), 0u);
+      writers.clear();
+
+      BOOST_REQUIRE_EQUAL(b.recv(), 5u);
+      for (unsigned i = 0; i < 5; ++i) {
+        BOOST_CHECK_EQUAL(string(b.data(i), b.length(i)),
+            "msg" + std::to_string(i));
+        BOOST_CHECK(!b.truncated(i));
+        BOOST_REQUIRE_EQUAL(b.nfds(i), i % 2 ? 0u : 1u);
+        if (b.nfds(i)) {
+          util::unique_fd w(b.take_fd(i, 0));
+          char c = 'a' + i;
+          posix::write(w.get(), &c, 1);
+          posix::read(readers[i].get(), &c, 1);
+          BOOST_CHECK_EQUAL(c, char('a' + i));
+        }
+      }
+      BOOST_CHECK_THROW(b.take_fd(1, 0), std::out_of_range);
+
+      // untaken descriptors are closed by the next recv()
+      int fds[1] = { readers[0].get() };
+      a.push("z", 1, fds, 1);
+      a.flush();
+      BOOST_REQUIRE_EQUAL(b.recv(), 1u);
+      BOOST_CHECK_EQUAL(b.nfds(0), 1u);
+      BOOST_CHECK_EQUAL(b.recv(), 0u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // scm
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,108 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/reactor.hh>
+#include <ixxx/signal_dispatcher.hh>
+
+#include <errno.h>
+#include <sys/types.h>
+#include <signal.h>
+#include <stdint.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/wait.h>
+#endif
+
+#include <map>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( signal_dispatcher )
+
+    BOOST_AUTO_TEST_CASE( basic )
+    {
+      util::signal_dispatcher d({ SIGUSR1 });
+      unsigned usr1 = 0, usr2 = 0;
+      d.on(SIGUSR1, [&usr1](const struct signalfd_siginfo &i) {
+          BOOST_CHECK_EQUAL(i.ssi_signo, unsigned(SIGUSR1));
+          ++usr1;
+        });
+      // added after construction
+      d.on(SIGUSR2, [&usr2](const struct signalfd_siginfo &) { ++usr2; });
+      BOOST_CHECK_EQUAL(d.process(), 0u);
+
+      ::raise(SIGUSR1);
+      ::raise(SIGUSR2);
+      util::reactor r;
+      r.add(d.fd(), EPOLLIN, [&d](int, uint32_t) { d.process(); });
+      BOOST_CHECK_EQUAL(r.run_once(1000), 1u);
+      BOOST_CHECK_EQUAL(usr1, 1u);
+      BOOST_CHECK_EQUAL(usr2, 1u);
+      r.remove(d.fd());
+    }
+
+    BOOST_AUTO_TEST_CASE( invalid )
+    {
+      BOOST_CHECK_THROW(util::signal_dispatcher d({ 4711 }),
+          pthread_sigmask_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( reap )
+    {
+      util::signal_dispatcher d;
+      std::map<pid_t, int> status;
+      d.on_child([&status](const siginfo_t &si) {
+          status[si.si_pid] = si.si_status;
+        });
+      vector<pid_t> pids;
+      for (int i = 0; i < 3; ++i) {
+        pid_t pid = posix::fork();
+        if (!pid)
+          _exit(i + 3);
+        pids.push_back(pid);
+      }
+      util::reactor r;
+      r.add(d.fd(), EPOLLIN, [&d](int, uint32_t) { d.process(); });
+      for (unsigned i = 0; i < 100 && status.size() < pids.size(); ++i)
+        r.run_once(100);
+      r.remove(d.fd());
+      BOOST_REQUIRE_EQUAL(status.size(), pids.size());
+      for (int i = 0; i < 3; ++i)
+        BOOST_CHECK_EQUAL(status[pids[i]], i + 3);
+      BOOST_CHECK_EQUAL(d.reaped(), 3u);
+    }
+
+    BOOST_AUTO_TEST_CASE( reap_without_child_handler )
+    {
+      util::signal_dispatcher d;
+      unsigned chld = 0;
+      d.on(SIGCHLD, [&chld](const struct signalfd_siginfo &) { ++chld; });
+      pid_t pid = posix::fork();
+      if (!pid)
+        _exit(0);
+      util::reactor r;
+      r.add(d.fd(), EPOLLIN, [&d](int, uint32_t) { d.process(); });
+      for (unsigned i = 0; i < 100 && !d.reaped(); ++i)
+        r.run_once(100);
+      r.remove(d.fd());
+      BOOST_CHECK(chld > 0);
+      BOOST_CHECK_EQUAL(d.reaped(), 1u);
+      BOOST_CHECK_EQUAL(::waitpid(pid, nullptr, WNOHANG), -1);
+      BOOST_CHECK_EQUAL(errno, ECHILD);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // signal_dispatcher
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,93 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/socket.hh>
+#include <ixxx/sockopt.hh>
+
+#include "loopback.hh"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include <set>
+#include <string>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( sockopt )
+
+    BOOST_AUTO_TEST_CASE( get_set )
+    {
+      namespace so = util::sockopt;
+      struct sockaddr_in addr;
+      util::unique_fd lfd(bind_loopback(SOCK_STREAM, addr));
+      util::unique_fd fd(connect_to(SOCK_STREAM, addr));
+
+      so::set<so::tcp_nodelay>(fd.get(), true);
+      BOOST_CHECK(so::get<so::tcp_nodelay>(fd.get()));
+      so::set<so::tcp_nodelay>(fd.get(), false);
+      BOOST_CHECK(!so::get<so::tcp_nodelay>(fd.get()));
+
+      so::set<so::so_rcvbuf>(fd.get(), 64 * 1024);
+      BOOST_CHECK_GE(so::get<so::so_rcvbuf>(fd.get()), 64 * 1024);
+
+      so::set<so::ip_tos>(fd.get(), 0x10);
+      BOOST_CHECK_EQUAL(so::get<so::ip_tos>(fd.get()), 0x10);
+
+      struct linger l = { 1, 3 };
+      so::set<so::so_linger>(fd.get(), l);
+      l = so::get<so::so_linger>(fd.get());
+      BOOST_CHECK_EQUAL(l.l_onoff, 1);
+      BOOST_CHECK_EQUAL(l.l_linger, 3);
+
+      struct timeval tv = { 2, 0 };
+      so::set<so::so_rcvtimeo>(fd.get(), tv);
+      BOOST_CHECK_EQUAL(so::get<so::so_rcvtimeo>(fd.get()).tv_sec, 2);
+
+      string cc = so::get<so::tcp_congestion>(fd.get());
+      BOOST_CHECK(!cc.empty());
+      BOOST_CHECK_NO_THROW(so::set<so::tcp_congestion>(fd.get(), cc));
+      BOOST_CHECK_THROW(so::set<so::tcp_congestion>(fd.get(), "no-such-cc"),
+          setsockopt_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( bundle )
+    {
+      namespace so = util::sockopt;
+      struct sockaddr_in addr;
+      util::unique_fd lfd(bind_loopback(SOCK_STREAM, addr));
+      util::unique_fd fd(connect_to(SOCK_STREAM, addr));
+
+      so::bundle<so::tcp_nodelay, so::ip_tos, so::so_sndbuf,
+          so::tcp_congestion> b;
+      BOOST_CHECK(b.empty());
+      int sndbuf = so::get<so::so_sndbuf>(fd.get());
+      b.set<so::tcp_nodelay>(true).set<so::ip_tos>(0x08);
+      BOOST_CHECK(b.is_set<so::ip_tos>());
+      BOOST_CHECK(!b.is_set<so::so_sndbuf>());
+      BOOST_CHECK_EQUAL(b.value<so::ip_tos>(), 0x08);
+      b.apply(fd.get());
+      BOOST_CHECK(so::get<so::tcp_nodelay>(fd.get()));
+      BOOST_CHECK_EQUAL(so::get<so::ip_tos>(fd.get()), 0x08);
+      // unset options aren't touched
+      BOOST_CHECK_EQUAL(so::get<so::so_sndbuf>(fd.get()), sndbuf);
+
+      b.set<so::tcp_congestion>("no-such-cc");
+      BOOST_CHECK_THROW(b.apply(fd.get()), setsockopt_error);
+      b.reset<so::tcp_congestion>();
+      BOOST_CHECK_NO_THROW(b.apply(fd.get()));
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // sockopt
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
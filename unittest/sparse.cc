@@ -0,0 +1,110 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+namespace fs = boost::filesystem;
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/sparse.hh>
+
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+#if defined(__linux__)
+static string slurp(const string &filename)
+{
+    int fd = posix::open(filename, O_RDONLY);
+    string s;
+    char buf[64 * 1024];
+    for (;;) {
+        ssize_t r = posix::read(fd, buf, sizeof buf);
+        if (!r)
+            break;
+        s.append(buf, r);
+    }
+    posix::close(fd);
+    return s;
+}
+
+static void mk_sparse_file(const string &filename)
+{
+    fs::create_directory("tmp");
+    fs::remove(filename);
+    int fd = posix::open(filename, O_CREAT | O_WRONLY, 0666);
+    string a(4096, 'a');
+    string b(4096, 'b');
+    posix::pwrite(fd, a.data(), a.size(), 0);
+    posix::pwrite(fd, b.data(), b.size(), 1024 * 1024);
+    posix::ftruncate(fd, 4 * 1024 * 1024);
+    posix::close(fd);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( sparse )
+
+    BOOST_AUTO_TEST_CASE( extents )
+    {
+      string filename("tmp/sparse");
+      mk_sparse_file(filename);
+      int fd = posix::open(filename, O_RDONLY);
+      for (auto m : { util::extent_reader::AUTO, util::extent_reader::SEEK }) {
+        util::extent_reader r(fd, m);
+        vector<util::extent> v;
+        util::extent e;
+        while (r.next(e))
+          v.push_back(e);
+        BOOST_REQUIRE_EQUAL(v.size(), 2u);
+        BOOST_CHECK_EQUAL(v[0].offset, 0);
+        BOOST_CHECK(v[0].length >= 4096);
+        BOOST_CHECK_EQUAL(v[1].offset, 1024 * 1024);
+        BOOST_CHECK(v[1].length >= 4096);
+        BOOST_CHECK(v[1].offset + v[1].length <= r.size());
+      }
+      posix::close(fd);
+    }
+
+    BOOST_AUTO_TEST_CASE( copy )
+    {
+      string src_name("tmp/sparse_src");
+      string dst_name("tmp/sparse_dst");
+      mk_sparse_file(src_name);
+      fs::remove(dst_name);
+      {
+        // pre-existing data must be replaced by holes
+        int fd = posix::open(dst_name, O_CREAT | O_WRONLY, 0666);
+        string z(8 * 1024 * 1024, 'z');
+        posix::write(fd, z.data(), z.size());
+        posix::close(fd);
+      }
+      int src = posix::open(src_name, O_RDONLY);
+      int dst = posix::open(dst_name, O_WRONLY);
+      off_t n = util::sparse_copy(src, dst);
+      BOOST_CHECK(n >= 2 * 4096);
+      BOOST_CHECK(n < 4 * 1024 * 1024);
+      posix::close(dst);
+      posix::close(src);
+
+      BOOST_CHECK(slurp(src_name) == slurp(dst_name));
+      struct stat b;
+      posix::stat(dst_name, &b);
+      BOOST_CHECK_EQUAL(b.st_size, 4 * 1024 * 1024);
+      BOOST_CHECK(b.st_blocks * 512 < b.st_size);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // sparse
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,165 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/thread.hh>
+
+#include <errno.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <atomic>
+#include <stdexcept>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( thread )
+
+    BOOST_AUTO_TEST_CASE( attributes )
+    {
+      char name[32] = { 0 };
+      int cpus = 0, cpu = -1, policy = -1;
+      util::thread_builder b;
+      b.name("worker-0123456789").cpu(0);
+      {
+        util::thread t = b.spawn([&] {
+              pthread_getname_np(pthread_self(), name, sizeof name);
+              cpu_set_t set;
+              linux::sched_getaffinity(0, sizeof set, &set);
+              cpus = CPU_COUNT(&set);
+              cpu = sched_getcpu();
+              struct sched_param p;
+              pthread_getschedparam(pthread_self(), &policy, &p);
+            });
+        BOOST_CHECK(t.joinable());
+        // destructor joins
+      }
+      BOOST_CHECK_EQUAL(name, "worker-01234567");
+      BOOST_CHECK_EQUAL(cpus, 1);
+      BOOST_CHECK_EQUAL(cpu, 0);
+      BOOST_CHECK_EQUAL(policy, SCHED_OTHER);
+
+      try {
+        b.policy(SCHED_FIFO, 1).spawn([&policy] {
+            struct sched_param p;
+            pthread_getschedparam(pthread_self(), &policy, &p);
+          }).join();
+        BOOST_CHECK_EQUAL(policy, SCHED_FIFO);
+      } catch (const pthread_create_error &e) {
+        if (e.code() != EPERM)
+          throw;
+        BOOST_TEST_MESSAGE("no permission for SCHED_FIFO");
+      }
+    }
+
+    static size_t own_stack_size(char **lo = nullptr)
+    {
+      pthread_attr_t attr;
+      pthread_getattr_np(pthread_self(), &attr);
+      void *addr;
+      size_t n;
+      pthread_attr_getstack(&attr, &addr, &n);
+      pthread_attr_destroy(&attr);
+      if (lo)
+        *lo = static_cast<char*>(addr);
+      return n;
+    }
+
+    BOOST_AUTO_TEST_CASE( stack )
+    {
+      size_t n = 0;
+      util::thread t = util::thread_builder().stack_size(size_t(1) << 20)
+        .guard_size(64 * 1024).spawn([&n] { n = own_stack_size(); });
+      t.join();
+      BOOST_CHECK(!t.joinable());
+      BOOST_CHECK_GE(n, size_t(1) << 20);
+      BOOST_CHECK_LT(n, size_t(2) << 20);
+    }
+
+    BOOST_AUTO_TEST_CASE( huge_page_stack )
+    {
+      size_t n = 0;
+      char *lo = nullptr;
+      bool inside = false;
+      util::thread t = util::thread_builder().huge_page_stack()
+        .stack_size(size_t(3) << 20).spawn([&] {
+            n = own_stack_size(&lo);
+            char x[64 * 1024];
+            memset(x, 1, sizeof x);
+            inside = x >= lo && x < lo + n;
+          });
+      t.join();
+      BOOST_CHECK_EQUAL(n, size_t(4) << 20);
+      BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(lo) % (size_t(2) << 20), 0u);
+      BOOST_CHECK(inside);
+    }
+
+    BOOST_AUTO_TEST_CASE( exception )
+    {
+      util::thread t = util::thread_builder().spawn([] {
+          throw std::runtime_error("from thread");
+        });
+      util::thread u(std::move(t));
+      BOOST_CHECK(!t.joinable());
+      BOOST_CHECK_THROW(u.join(), std::runtime_error);
+      // invalid CPU set, i.e. pthread_create() fails
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      BOOST_CHECK_THROW(util::thread_builder().affinity(set).spawn([] {}),
+          pthread_create_error);
+      BOOST_CHECK_THROW(util::thread_builder().cpu(CPU_SETSIZE),
+          pthread_attr_setaffinity_np_error);
+      BOOST_CHECK_THROW(util::thread_builder().cpu(-1),
+          pthread_attr_setaffinity_np_error);
+    }
+
+    BOOST_AUTO_TEST_CASE( self_join )
+    {
+      util::thread t;
+      BOOST_CHECK_THROW(t.native_handle(), std::logic_error);
+      std::atomic<bool> ready(false);
+      bool threw = false;
+      t = util::thread_builder().spawn([&t, &ready, &threw] {
+          while (!ready.load())
+            sched_yield();
+          try {
+            t.join();
+          } catch (const std::logic_error &) {
+            threw = true;
+          }
+        });
+      ready.store(true);
+      BOOST_CHECK(t.joinable());
+      t.join();
+      BOOST_CHECK(threw);
+      BOOST_CHECK(!t.joinable());
+    }
+
+    BOOST_AUTO_TEST_CASE( self_destroy )
+    {
+      // the thread owns its handle, i.e. it's detached
+      util::thread *t = new util::thread();
+      std::atomic<bool> ready(false), done(false);
+      *t = util::thread_builder().spawn([t, &ready, &done] {
+          while (!ready.load())
+            sched_yield();
+          delete t;
+          done.store(true);
+        });
+      ready.store(true);
+      while (!done.load())
+        sched_yield();
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // thread
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,180 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/timer_wheel.hh>
+
+#include <errno.h>
+#include <poll.h>
+#include <stdint.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( timer_wheel )
+
+    using std::chrono::milliseconds;
+    using std::chrono::microseconds;
+
+    static int64_t elapsed_ms(std::chrono::steady_clock::time_point t)
+    {
+      return std::chrono::duration_cast<milliseconds>(
+          std::chrono::steady_clock::now() - t).count();
+    }
+
+    BOOST_AUTO_TEST_CASE( order_and_cancel )
+    {
+      util::timer_wheel w;
+      vector<int> fired;
+      auto start = std::chrono::steady_clock::now();
+      w.schedule(milliseconds(20), [&] { fired.push_back(20); });
+      util::timer_wheel::timer_id id =
+          w.schedule(milliseconds(10), [&] { fired.push_back(10); });
+      w.schedule(milliseconds(5), [&] { fired.push_back(5); });
+      BOOST_CHECK_EQUAL(w.size(), 3u);
+      BOOST_CHECK(w.cancel(id));
+      BOOST_CHECK(!w.cancel(id));
+      BOOST_CHECK_EQUAL(w.size(), 2u);
+      for (unsigned i = 0; i < 100 && w.size(); ++i)
+        w.run_once(100);
+      BOOST_REQUIRE_EQUAL(fired.size(), 2u);
+      BOOST_CHECK_EQUAL(fired[0], 5);
+      BOOST_CHECK_EQUAL(fired[1], 20);
+      BOOST_CHECK_GE(elapsed_ms(start), 20);
+      // nothing left, i.e. the timerfd is disarmed
+      struct pollfd p = { w.fd(), POLLIN, 0 };
+      BOOST_CHECK_EQUAL(posix::poll(&p, 1, 30), 0);
+    }
+
+    BOOST_AUTO_TEST_CASE( cascade )
+    {
+      // with 10us resolution 3ms is on level 1 and 700ms on level 2
+      util::timer_wheel w(microseconds(10));
+      vector<int> fired;
+      auto start = std::chrono::steady_clock::now();
+      w.schedule(milliseconds(700), [&] {
+          fired.push_back(700);
+          BOOST_CHECK_GE(elapsed_ms(start), 700);
+        });
+      w.schedule(milliseconds(3), [&] {
+          fired.push_back(3);
+          BOOST_CHECK_GE(elapsed_ms(start), 3);
+        });
+      for (unsigned i = 0; i < 100 && w.size(); ++i)
+        w.run_once(100);
+      BOOST_REQUIRE_EQUAL(fired.size(), 2u);
+      BOOST_CHECK_EQUAL(fired[0], 3);
+      BOOST_CHECK_EQUAL(fired[1], 700);
+      BOOST_CHECK_LT(elapsed_ms(start), 2000);
+    }
+
+    BOOST_AUTO_TEST_CASE( top_level )
+    {
+      // with 1ns resolution everything beyond ~17ms is on level 3
+      util::timer_wheel w(std::chrono::nanoseconds(1));
+      vector<int> fired;
+      auto start = std::chrono::steady_clock::now();
+      for (int d : { 40, 5, 25, 60 })
+        w.schedule(milliseconds(d), [&fired, d, start] {
+            fired.push_back(d);
+            BOOST_CHECK_GE(elapsed_ms(start), d);
+          });
+      for (unsigned i = 0; i < 100 && w.size(); ++i)
+        w.run_once(100);
+      BOOST_CHECK((fired == vector<int>{ 5, 25, 40, 60 }));
+    }
+
+    BOOST_AUTO_TEST_CASE( reschedule_from_callback )
+    {
+      util::timer_wheel w;
+      unsigned n = 0;
+      util::timer_wheel::timer_id victim =
+          w.schedule(milliseconds(30), [&] { n += 100; });
+      std::function<void()> tick = [&] {
+        if (++n < 3)
+          w.schedule(milliseconds(1), tick);
+        else
+          w.cancel(victim);
+      };
+      w.schedule(milliseconds(0), tick);
+      for (unsigned i = 0; i < 100 && w.size(); ++i)
+        w.run_once(100);
+      BOOST_CHECK_EQUAL(n, 3u);
+    }
+
+    BOOST_AUTO_TEST_CASE( many )
+    {
+      util::timer_wheel w;
+      unsigned n = 0;
+      vector<util::timer_wheel::timer_id> ids;
+      for (unsigned i = 0; i < 10000; ++i)
+        ids.push_back(w.schedule(milliseconds(i % 50), [&] { ++n; }));
+      for (unsigned i = 0; i < ids.size(); i += 2)
+        w.cancel(ids[i]);
+      // epoll integration
+      util::unique_fd epfd(linux::epoll_create1(0));
+      struct epoll_event ev = { 0 };
+      ev.events = EPOLLIN;
+      linux::epoll_ctl(epfd.get(), EPOLL_CTL_ADD, w.fd(), &ev);
+      for (unsigned i = 0; i < 200 && w.size(); ++i) {
+        if (linux::epoll_wait(epfd.get(), &ev, 1, 100) == 1)
+          w.process();
+      }
+      BOOST_CHECK_EQUAL(n, 5000u);
+      BOOST_CHECK_EQUAL(w.size(), 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE( overruns )
+    {
+      util::timer_wheel w;
+      unsigned n = 0;
+      w.schedule(milliseconds(1), [&n] { ++n; });
+      w.schedule(milliseconds(1), [&n] {
+          ++n;
+          // stalls the loop
+          std::this_thread::sleep_for(milliseconds(20));
+        });
+      w.schedule(milliseconds(5), [&n] { ++n; });
+      std::this_thread::sleep_for(milliseconds(2));
+      BOOST_CHECK_EQUAL(w.process(), 2u);
+      uint64_t before = w.overruns();
+      for (unsigned i = 0; i < 100 && w.size(); ++i)
+        w.run_once(100);
+      BOOST_CHECK_EQUAL(n, 3u);
+      BOOST_CHECK_EQUAL(w.overruns(), before + 1);
+      BOOST_CHECK_GE(w.max_lateness(), milliseconds(10));
+    }
+
+    BOOST_AUTO_TEST_CASE( schedule_after_idle )
+    {
+      // 2^32 - 1 ticks are ~4.3 s with 1 ns resolution
+      util::timer_wheel w(std::chrono::nanoseconds(1));
+      std::this_thread::sleep_for(milliseconds(500));
+      w.schedule(milliseconds(4200), [] {});
+      struct itimerspec its;
+      BOOST_REQUIRE_EQUAL(::timerfd_gettime(w.fd(), &its), 0);
+      // the delay isn't capped relative to the stale construction time
+      BOOST_CHECK_GE(its.it_value.tv_sec, 4);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // timer_wheel
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,140 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/histogram.hh>
+#include <ixxx/socket.hh>
+#include <ixxx/timestamping.hh>
+
+#include "loopback.hh"
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( timestamping )
+
+    BOOST_AUTO_TEST_CASE( loopback_latency )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::unique_fd sfd(connect_to(SOCK_DGRAM, addr));
+      posix::fcntl(sfd.get(), F_SETFL,
+          posix::fcntl(sfd.get(), F_GETFL, 0) | O_NONBLOCK);
+      util::set_timestamping(rfd.get(), SOF_TIMESTAMPING_RX_SOFTWARE
+          | SOF_TIMESTAMPING_SOFTWARE);
+      // the kernel may enable timestamp generation asynchronously,
+      // i.e. the first packets might not carry one
+      for (unsigned i = 0; i < 100; ++i) {
+        unsigned v = 0;
+        posix::send(sfd.get(), &v, sizeof v, 0);
+        struct iovec iov = { &v, sizeof v };
+        vector<char> control(util::timestamp_cmsg_space);
+        struct msghdr h = msghdr();
+        h.msg_iov        = &iov;
+        h.msg_iovlen     = 1;
+        h.msg_control    = control.data();
+        h.msg_controllen = control.size();
+        posix::recvmsg(rfd.get(), &h, 0);
+        util::packet_timestamps ts;
+        if (util::get_timestamps(h, ts))
+          break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      // after the probes, since OPT_ID counts the sent packets
+      util::set_timestamping(sfd.get(), SOF_TIMESTAMPING_TX_SOFTWARE
+          | SOF_TIMESTAMPING_SOFTWARE | SOF_TIMESTAMPING_OPT_ID
+          | SOF_TIMESTAMPING_OPT_TSONLY);
+
+      const unsigned n = 10;
+      for (unsigned i = 0; i < n; ++i)
+        posix::send(sfd.get(), &i, sizeof i, 0);
+
+      vector<struct timespec> rx(n);
+      for (unsigned i = 0; i < n; ++i) {
+        unsigned v;
+        struct iovec iov = { &v, sizeof v };
+        vector<char> control(util::timestamp_cmsg_space);
+        struct msghdr h = msghdr();
+        h.msg_iov        = &iov;
+        h.msg_iovlen     = 1;
+        h.msg_control    = control.data();
+        h.msg_controllen = control.size();
+        BOOST_REQUIRE_EQUAL(posix::recvmsg(rfd.get(), &h, 0), ssize_t(sizeof v));
+        BOOST_REQUIRE_LT(v, n);
+        util::packet_timestamps ts;
+        BOOST_REQUIRE(util::get_timestamps(h, ts));
+        BOOST_CHECK(ts.has_software);
+        BOOST_CHECK(!ts.has_hardware);
+        rx[v] = ts.software;
+      }
+
+      util::latency_histogram hist;
+      util::tx_timestamp t;
+      unsigned k = 0;
+      for (unsigned i = 0; i < 100 && k < n; ++i) {
+        while (util::read_tx_timestamp(sfd.get(), t)) {
+          BOOST_REQUIRE_LT(t.id, n);
+          BOOST_CHECK_EQUAL(t.type, unsigned(SCM_TSTAMP_SND));
+          BOOST_CHECK(t.ts.has_software);
+          BOOST_CHECK_GE(util::diff_ns(t.ts.software, rx[t.id]), 0);
+          hist.add(t.ts.software, rx[t.id]);
+          ++k;
+        }
+        if (k < n)
+          usleep(1000);
+      }
+      BOOST_CHECK_EQUAL(k, n);
+      BOOST_CHECK_EQUAL(hist.count(), n);
+      // loopback latency is well below a second
+      BOOST_CHECK_LT(hist.percentile(99), 1000000000u);
+    }
+
+    BOOST_AUTO_TEST_CASE( timestampns )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::unique_fd sfd(connect_to(SOCK_DGRAM, addr));
+      util::set_timestampns(rfd.get());
+      struct timespec before;
+      posix::clock_gettime(CLOCK_REALTIME, &before);
+      posix::send(sfd.get(), "x", 1, 0);
+      char c;
+      struct iovec iov = { &c, 1 };
+      union {
+        char buf[util::timestamp_cmsg_space];
+        struct cmsghdr align;
+      } control;
+      struct msghdr h = msghdr();
+      h.msg_iov        = &iov;
+      h.msg_iovlen     = 1;
+      h.msg_control    = control.buf;
+      h.msg_controllen = sizeof control.buf;
+      posix::recvmsg(rfd.get(), &h, 0);
+      util::packet_timestamps ts;
+      BOOST_REQUIRE(util::get_timestamps(h, ts));
+      BOOST_CHECK(ts.has_software);
+      BOOST_CHECK_GE(util::diff_ns(before, ts.software), 0);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // timestamping
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,140 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+namespace fs = boost::filesystem;
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/thread.hh>
+#include <ixxx/topology.hh>
+
+#include <sched.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( topology )
+
+    static void put(const string &path, const string &s)
+    {
+      fs::create_directories(fs::path(path).parent_path());
+      ofstream o(path);
+      o << s << '\n';
+    }
+
+    static void fake_cpu(const string &root, int id, int core, const string &sib,
+        const string &l2, const string &l3)
+    {
+      string d = root + "/cpu/cpu" + to_string(id) + "/";
+      put(d + "topology/core_id", to_string(core));
+      put(d + "topology/physical_package_id", "0");
+      put(d + "topology/thread_siblings_list", sib);
+      put(d + "cache/index0/level", "1");
+      put(d + "cache/index0/type", "Data");
+      put(d + "cache/index0/shared_cpu_list", sib);
+      put(d + "cache/index1/level", "1");
+      put(d + "cache/index1/type", "Instruction");
+      put(d + "cache/index1/shared_cpu_list", sib);
+      put(d + "cache/index2/level", "2");
+      put(d + "cache/index2/type", "Unified");
+      put(d + "cache/index2/shared_cpu_list", l2);
+      put(d + "cache/index3/level", "3");
+      put(d + "cache/index3/type", "Unified");
+      put(d + "cache/index3/shared_cpu_list", l3);
+    }
+
+    BOOST_AUTO_TEST_CASE( cpu_list )
+    {
+      BOOST_CHECK((util::topology::parse_cpu_list("0-3,8,10-11")
+            == vector<int>{0, 1, 2, 3, 8, 10, 11}));
+      BOOST_CHECK((util::topology::parse_cpu_list("5") == vector<int>{5}));
+      BOOST_CHECK(util::topology::parse_cpu_list("").empty());
+
+      cpu_set_t set = util::topology::to_cpu_set({1, 3});
+      BOOST_CHECK_EQUAL(CPU_COUNT(&set), 2);
+      BOOST_CHECK(CPU_ISSET(1, &set));
+      BOOST_CHECK(CPU_ISSET(3, &set));
+    }
+
+    BOOST_AUTO_TEST_CASE( fake_sysfs )
+    {
+      // 2 nodes, each with 2 cores with 2 SMT threads, L3 per node
+      fs::remove_all("tmp/topo");
+      put("tmp/topo/cpu/online", "0-7");
+      for (int i = 0; i < 8; ++i) {
+        int core = i % 4;
+        string sib = to_string(core) + "," + to_string(core + 4);
+        fake_cpu("tmp/topo", i, core, sib, sib,
+            core < 2 ? "0-1,4-5" : "2-3,6-7");
+      }
+      put("tmp/topo/node/online", "0-1");
+      put("tmp/topo/node/node0/cpulist", "0-1,4-5");
+      put("tmp/topo/node/node1/cpulist", "2-3,6-7");
+
+      // CPU 5 isn't allowed, e.g. because of a cgroup cpuset
+      cpu_set_t allowed = util::topology::to_cpu_set({0, 1, 2, 3, 4, 6, 7});
+      util::topology t("tmp/topo", &allowed);
+      BOOST_REQUIRE_EQUAL(t.cpus().size(), 8u);
+      BOOST_CHECK_EQUAL(t.cpu(6)->core, 2);
+      BOOST_CHECK_EQUAL(t.cpu(6)->node, 1);
+      BOOST_CHECK(!t.cpu(5)->allowed);
+      BOOST_CHECK(!t.cpu(8));
+
+      BOOST_CHECK((t.allowed() == vector<int>{0, 1, 2, 3, 4, 6, 7}));
+      BOOST_CHECK((t.one_per_core() == vector<int>{0, 1, 2, 3}));
+      BOOST_CHECK((t.siblings(0) == vector<int>{0, 4}));
+      BOOST_CHECK((t.siblings(1) == vector<int>{1}));
+      BOOST_CHECK((t.sharing_l2(6) == vector<int>{2, 6}));
+      BOOST_CHECK((t.sharing_l3(0) == vector<int>{0, 1, 4}));
+      BOOST_CHECK((t.sharing_l3(7) == vector<int>{2, 3, 6, 7}));
+      BOOST_CHECK((t.nodes() == vector<int>{0, 1}));
+      BOOST_CHECK((t.node_cpus(1) == vector<int>{2, 3, 6, 7}));
+    }
+
+    BOOST_AUTO_TEST_CASE( no_cache )
+    {
+      // e.g. a VM without cache/ and thread_siblings_list
+      fs::remove_all("tmp/topo");
+      put("tmp/topo/cpu/online", "0-1");
+      put("tmp/topo/cpu/cpu0/topology/core_id", "0");
+      put("tmp/topo/cpu/cpu1/topology/core_id", "1");
+      cpu_set_t allowed = util::topology::to_cpu_set({0, 1});
+      util::topology t("tmp/topo", &allowed);
+      BOOST_REQUIRE_EQUAL(t.cpus().size(), 2u);
+      BOOST_CHECK((t.siblings(1) == vector<int>{1}));
+      BOOST_CHECK((t.sharing_l2(0) == vector<int>{0}));
+      BOOST_CHECK((t.sharing_l3(1) == vector<int>{1}));
+      BOOST_CHECK((t.nodes() == vector<int>{0}));
+    }
+
+    BOOST_AUTO_TEST_CASE( system )
+    {
+      util::topology t;
+      BOOST_REQUIRE(!t.cpus().empty());
+      auto v = t.one_per_core();
+      BOOST_REQUIRE(!v.empty());
+      auto s = t.siblings(v.front());
+      BOOST_CHECK(find(s.begin(), s.end(), v.front()) != s.end());
+
+      cpu_set_t set = util::topology::to_cpu_set(v);
+      int cpu = -1;
+      util::thread_builder().affinity(set).spawn([&cpu] {
+            cpu = sched_getcpu();
+          }).join();
+      BOOST_CHECK(find(v.begin(), v.end(), cpu) != v.end());
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // topology
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
@@ -0,0 +1,107 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/socket.hh>
+#include <ixxx/udp_offload.hh>
+
+#include "loopback.hh"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#include <string>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( udp_offload )
+
+    BOOST_AUTO_TEST_CASE( gso_gro_loopback )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::set_udp_gro(rfd.get());
+      util::unique_fd sfd(posix::socket(AF_INET, SOCK_DGRAM, 0));
+
+      util::gso_sender out(100, 16);
+      BOOST_CHECK_EQUAL(out.capacity(), 16u);
+      for (unsigned i = 0; i < 10; ++i) {
+        string s(100, char('a' + i));
+        BOOST_CHECK(out.push(s.data(), s.size()));
+      }
+      BOOST_CHECK(out.push("short", 5));
+      // after a short segment nothing can be appended
+      BOOST_CHECK(!out.push("x", 1));
+      BOOST_CHECK_EQUAL(out.send(sfd.get(),
+            reinterpret_cast<const struct sockaddr*>(&addr), sizeof addr), 11u);
+      BOOST_CHECK_EQUAL(out.size(), 0u);
+
+      util::gro_receiver in;
+      vector<string> v;
+      while (v.size() < 11) {
+        size_t n = in.recv(rfd.get(), [&v](const char *p, size_t n) {
+            v.emplace_back(p, n); }, MSG_DONTWAIT);
+        BOOST_REQUIRE(n);
+      }
+      BOOST_REQUIRE_EQUAL(v.size(), 11u);
+      for (unsigned i = 0; i < 10; ++i)
+        BOOST_CHECK_EQUAL(v[i], string(100, char('a' + i)));
+      BOOST_CHECK_EQUAL(v[10], "short");
+      BOOST_CHECK_EQUAL(in.addr().ss_family, AF_INET);
+    }
+
+    BOOST_AUTO_TEST_CASE( gro_truncated )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd rfd(bind_loopback(SOCK_DGRAM, addr));
+      util::set_udp_gro(rfd.get());
+      util::unique_fd sfd(connect_to(SOCK_DGRAM, addr));
+      string s(300, 'x');
+      util::gro_receiver in(150);
+      vector<string> v;
+      auto f = [&v](const char *p, size_t n) { v.emplace_back(p, n); };
+
+      posix::send(sfd.get(), s.data(), s.size(), 0);
+      BOOST_CHECK_EQUAL(in.recv(rfd.get(), f), 1u);
+      BOOST_CHECK(in.truncated());
+      BOOST_CHECK_EQUAL(v.back().size(), 150u);
+
+      posix::send(sfd.get(), s.data(), 100, 0);
+      BOOST_CHECK_EQUAL(in.recv(rfd.get(), f), 1u);
+      BOOST_CHECK(!in.truncated());
+      BOOST_CHECK_EQUAL(v.back().size(), 100u);
+    }
+
+    BOOST_AUTO_TEST_CASE( cmsg_space )
+    {
+      // usable for sizing a buffer on the stack
+      union {
+        char buf[util::udp_segment_cmsg_space];
+        struct cmsghdr align;
+      } control;
+      struct msghdr h = msghdr();
+      util::put_udp_segment_cmsg(h, control.buf, 1200);
+      BOOST_CHECK_EQUAL(h.msg_controllen, sizeof control.buf);
+    }
+
+    BOOST_AUTO_TEST_CASE( gso_capacity )
+    {
+      util::gso_sender out(9000);
+      BOOST_CHECK_EQUAL(out.capacity(), 7u);
+      util::gso_sender small(100, 1000);
+      BOOST_CHECK_EQUAL(small.capacity(), 64u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // udp_offload
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
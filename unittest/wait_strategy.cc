@@ -0,0 +1,132 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/event_queue.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/reactor.hh>
+#include <ixxx/wait_strategy.hh>
+
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( wait_strategy )
+
+    BOOST_AUTO_TEST_CASE( spin_hit )
+    {
+      util::wait_strategy w;
+      BOOST_CHECK_EQUAL(w.spin_budget().count(), 50000);
+      unsigned polls = 0, blocks = 0;
+      auto poll  = [&polls] { return ++polls % 4 == 0 ? 1u : 0u; };
+      auto block = [&blocks] { ++blocks; return 1u; };
+      BOOST_CHECK_EQUAL(w.wait(poll, block), 1u);
+      BOOST_CHECK_EQUAL(polls, 4u);
+      BOOST_CHECK_EQUAL(blocks, 0u);
+      BOOST_CHECK_EQUAL(w.stats().spin_hits, 1u);
+      BOOST_CHECK_EQUAL(w.stats().sleeps, 0u);
+      BOOST_CHECK_EQUAL(w.idle_times().count(), 1u);
+
+      polls = 3;
+      BOOST_CHECK_EQUAL(w.wait(poll, block), 1u);
+      BOOST_CHECK_EQUAL(w.stats().immediate, 1u);
+      BOOST_CHECK_EQUAL(w.idle_times().count(), 1u);
+      w.clear_stats();
+      BOOST_CHECK_EQUAL(w.stats().spin_hits, 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE( adapt )
+    {
+      util::wait_strategy::config c;
+      c.min_spin = std::chrono::microseconds(1);
+      c.max_spin = std::chrono::microseconds(20);
+      util::wait_strategy w(c);
+      unsigned blocks = 0;
+      auto never = [] { return 0u; };
+      // work always arrives much later than the spin budget
+      auto late = [&blocks] {
+        ++blocks;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return 1u;
+      };
+      for (int i = 0; i < 20; ++i)
+        BOOST_CHECK_EQUAL(w.wait(never, late), 1u);
+      BOOST_CHECK_EQUAL(blocks, 20u);
+      BOOST_CHECK_EQUAL(w.stats().sleeps, 20u);
+      BOOST_CHECK(w.stats().spin_misses > 0u);
+      // CPU time, i.e. less than the wall-clock budget when preempted
+      BOOST_CHECK(w.stats().spin_ns > 0u);
+      BOOST_CHECK_EQUAL(w.spin_budget().count(), 1000);
+      BOOST_CHECK(w.idle_times().min() >= 1000000u);
+
+      // a timeout doesn't influence the budget
+      BOOST_CHECK_EQUAL(w.wait(never, [] { return 0u; }), 0u);
+      BOOST_CHECK_EQUAL(w.spin_budget().count(), 1000);
+
+      // work arrives quickly again - a preempted iteration pushes the
+      // moving average above max_spin, thus don't assume a fixed count
+      for (int i = 0; i < 1000 && w.spin_budget().count() <= 1000; ++i)
+        w.wait(never, [] { return 1u; });
+      BOOST_CHECK(w.spin_budget().count() > 1000);
+      BOOST_CHECK(w.spin_budget().count() <= 20000);
+    }
+
+    BOOST_AUTO_TEST_CASE( reactor )
+    {
+      util::wait_strategy w;
+      util::reactor r;
+      util::unique_fd efd(linux::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC));
+      unsigned calls = 0;
+      r.add(efd.get(), EPOLLIN, [&calls](int fd, uint32_t) {
+          uint64_t v;
+          posix::read(fd, &v, sizeof v);
+          ++calls;
+        });
+      uint64_t one = 1;
+      posix::write(efd.get(), &one, sizeof one);
+      BOOST_CHECK_EQUAL(w.run_once(r, 1000), 1u);
+      BOOST_CHECK_EQUAL(w.stats().immediate, 1u);
+      BOOST_CHECK_EQUAL(w.run_once(r, 0), 0u);
+      BOOST_CHECK_EQUAL(w.stats().sleeps, 1u);
+      BOOST_CHECK_EQUAL(calls, 1u);
+      r.remove(efd.get());
+    }
+
+    BOOST_AUTO_TEST_CASE( event_queue )
+    {
+      util::wait_strategy w;
+      util::event_queue<int> q(16);
+      std::thread t([&q] {
+          std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          q.try_push(23);
+        });
+      int x = 0;
+      size_t n = 0;
+      for (unsigned i = 0; i < 100 && !n; ++i)
+        n = w.drain(q, [&x](int y) { x = y; }, 100);
+      t.join();
+      BOOST_CHECK_EQUAL(n, 1u);
+      BOOST_CHECK_EQUAL(x, 23);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // wait_strategy
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx
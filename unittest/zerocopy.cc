@@ -0,0 +1,82 @@
+// Copyright (c) 2026, Georg Sauthoff <mail@georg.so>
+
+// SPDX-License-Identifier: BSD-2-Clause
+
+#include <boost/test/unit_test.hpp>
+
+#include <ixxx/ixxx.hh>
+#include <ixxx/fd.hh>
+#include <ixxx/socket.hh>
+#include <ixxx/zerocopy.hh>
+
+#include "loopback.hh"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+#include <string>
+#include <vector>
+using namespace std;
+using namespace ixxx;
+
+
+BOOST_AUTO_TEST_SUITE( ixxx )
+
+#if defined(__linux__)
+  BOOST_AUTO_TEST_SUITE( zerocopy )
+
+    BOOST_AUTO_TEST_CASE( tcp_loopback )
+    {
+      struct sockaddr_in addr;
+      util::unique_fd lfd(bind_loopback(SOCK_STREAM, addr));
+      util::unique_fd cfd(connect_to(SOCK_STREAM, addr));
+      util::unique_fd sfd(posix::accept(lfd.get(), nullptr, nullptr));
+
+      vector<uint64_t> tags;
+      util::zerocopy_sender z(cfd.get(), [&tags](uint64_t tag, bool) {
+          tags.push_back(tag); });
+
+      util::unique_fd epfd(linux::epoll_create1(EPOLL_CLOEXEC));
+      struct epoll_event ev = { 0 };
+      ev.events = 0; // EPOLLERR is always reported
+      linux::epoll_ctl(epfd.get(), EPOLL_CTL_ADD, cfd.get(), &ev);
+
+      vector<string> bufs;
+      for (unsigned i = 0; i < 3; ++i)
+        bufs.emplace_back(16 * 1024, char('a' + i));
+      size_t total = 0;
+      for (unsigned i = 0; i < 3; ++i) {
+        size_t n = z.send(bufs[i].data(), bufs[i].size(), 100 + i);
+        BOOST_CHECK_EQUAL(n, bufs[i].size());
+        total += n;
+      }
+      string in;
+      while (in.size() < total) {
+        char buf[64 * 1024];
+        in.append(buf, posix::read(sfd.get(), buf, sizeof buf));
+      }
+      BOOST_CHECK(in == bufs[0] + bufs[1] + bufs[2]);
+
+      for (unsigned i = 0; i < 100 && z.pending(); ++i) {
+        if (linux::epoll_wait(epfd.get(), &ev, 1, 100) == 1) {
+          BOOST_CHECK(ev.events & EPOLLERR);
+          z.process_completions();
+        }
+      }
+      BOOST_CHECK_EQUAL(z.pending(), 0u);
+      BOOST_REQUIRE_EQUAL(tags.size(), 3u);
+      BOOST_CHECK_EQUAL(tags[0], 100u);
+      BOOST_CHECK_EQUAL(tags[1], 101u);
+      BOOST_CHECK_EQUAL(tags[2], 102u);
+    }
+
+  BOOST_AUTO_TEST_SUITE_END() // zerocopy
+#endif
+
+BOOST_AUTO_TEST_SUITE_END() // ixxx